@@ -0,0 +1,409 @@
+#include "clustered_lights.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+#include "parallel.h"
+
+// x86'da SSE2 her zaman var; diğer mimarilerde skaler yol kullanılır
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CLUSTER_SIMD 1
+#else
+#define CLUSTER_SIMD 0
+#endif
+
+void setLightingTextureUnits(Shader& shader) {
+    shader.use();
+    shader.setInt("shadowMap", SHADOW_TEXTURE_UNIT);
+    shader.setInt("clusterGrid", CLUSTER_GRID_TEXTURE_UNIT);
+    shader.setInt("lightIndices", LIGHT_INDEX_TEXTURE_UNIT);
+    shader.setInt("lightData", LIGHT_DATA_TEXTURE_UNIT);
+    shader.setInt("albedoTexture", ALBEDO_TEXTURE_UNIT);
+}
+
+std::vector<PointLight> generatePointLights(unsigned int count, float extent, unsigned int seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> horizontal(-extent, extent);
+    std::uniform_real_distribution<float> vertical(-extent * 0.25f, extent * 0.25f);
+    std::uniform_real_distribution<float> radius(1.5f, 3.5f);
+    std::uniform_real_distribution<float> channel(0.0f, 1.0f);
+    std::uniform_real_distribution<float> intensity(0.6f, 1.5f);
+
+    std::vector<PointLight> lights(count);
+    for (PointLight& light : lights) {
+        light.position[0] = horizontal(rng);
+        light.position[1] = vertical(rng);
+        light.position[2] = horizontal(rng);
+        light.radius = radius(rng);
+
+        // Doygun renkler - en güçlü kanal 1'e çekilir
+        float r = channel(rng), g = channel(rng), b = channel(rng);
+        float strongest = std::max(std::max(r, g), std::max(b, 0.001f));
+        light.color[0] = r / strongest;
+        light.color[1] = g / strongest;
+        light.color[2] = b / strongest;
+        light.intensity = intensity(rng);
+    }
+    return lights;
+}
+
+bool ClusteredLights::init() {
+    GLint maxTexels = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &maxTexels);
+    if (maxTexels > 0) {
+        maxBufferTexels = maxTexels;
+    }
+
+    // Her buffer dokusu kendi tamponuna bir kez bağlanır; tampon içeriği her karede yenilenir
+    unsigned int* buffers[] = { &gridBuffer, &indexBuffer, &lightBuffer };
+    unsigned int* textures[] = { &gridTexture, &indexTexture, &lightTexture };
+    const GLenum formats[] = { GL_RG32UI, GL_R32UI, GL_RGBA32F };
+    for (int i = 0; i < 3; i++) {
+        glGenBuffers(1, buffers[i]);
+        glBindBuffer(GL_TEXTURE_BUFFER, *buffers[i]);
+        glBufferData(GL_TEXTURE_BUFFER, 16, NULL, GL_STREAM_DRAW);
+        glGenTextures(1, textures[i]);
+        glBindTexture(GL_TEXTURE_BUFFER, *textures[i]);
+        glTexBuffer(GL_TEXTURE_BUFFER, formats[i], *buffers[i]);
+    }
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+    clusterLights.resize(CLUSTER_COUNT);
+    grid.resize(CLUSTER_COUNT * 2);
+    return true;
+}
+
+void ClusteredLights::setLights(const std::vector<PointLight>& newLights) {
+    lights = newLights;
+    size_t padded = (lights.size() + 3) & ~size_t(3);
+    positionX.assign(padded, 0.0f);
+    positionY.assign(padded, 0.0f);
+    positionZ.assign(padded, 0.0f);
+    radii.assign(padded, 0.0f);
+    for (std::vector<int>* bounds : { &minX, &maxX, &minY, &maxY, &minZ, &maxZ }) {
+        bounds->assign(lights.size(), 0);
+    }
+    lightTexels.resize(lights.size() * 8);
+    animate(0.0f);
+}
+
+void ClusteredLights::animate(float time) {
+    for (size_t i = 0; i < lights.size(); i++) {
+        const PointLight& light = lights[i];
+
+        // Işık başına farklı hız ve faz - temel konumun çevresinde yatay daire ve dikey salınım
+        float speed = 0.3f + (float)(i % 7) * 0.1f;
+        float phase = (float)i * 0.618034f * 6.2831853f;
+        float angle = time * speed + phase;
+        positionX[i] = light.position[0] + std::cos(angle) * 1.5f;
+        positionY[i] = light.position[1] + std::sin(angle * 1.3f) * 0.5f;
+        positionZ[i] = light.position[2] + std::sin(angle) * 1.5f;
+        radii[i] = light.radius;
+
+        float* texel = &lightTexels[i * 8];
+        texel[0] = positionX[i];
+        texel[1] = positionY[i];
+        texel[2] = positionZ[i];
+        texel[3] = light.radius;
+        texel[4] = light.color[0] * light.intensity;
+        texel[5] = light.color[1] * light.intensity;
+        texel[6] = light.color[2] * light.intensity;
+        texel[7] = 0.0f;
+    }
+}
+
+// Derinliği üstel dağılmış Z dilimine çevirir (fragment.glsl ile aynı formül)
+static inline int depthSlice(float depth, float scale, float bias) {
+    int slice = (int)std::floor(std::log(depth) * scale + bias);
+    return std::max(0, std::min(slice, (int)CLUSTER_Z - 1));
+}
+
+void ClusteredLights::computeBoundsScalar(size_t begin, size_t end, const float* view, const float* projection,
+                                          float nearPlane, float farPlane) {
+    const float scale = (float)CLUSTER_Z / std::log(farPlane / nearPlane);
+    const float bias = -scale * std::log(nearPlane);
+
+    for (size_t i = begin; i < end; i++) {
+        // Görünüm uzayına dönüştür
+        float x = view[0] * positionX[i] + view[4] * positionY[i] + view[8] * positionZ[i] + view[12];
+        float y = view[1] * positionX[i] + view[5] * positionY[i] + view[9] * positionZ[i] + view[13];
+        float z = view[2] * positionX[i] + view[6] * positionY[i] + view[10] * positionZ[i] + view[14];
+        float r = radii[i];
+
+        // Sütun/satır sınırları kameradan geçen düzlemlerdir; tamamen sağında (üstünde) ve
+        // tamamen solunda (altında) kalınan sınırlar sayılarak kapsanan aralık bulunur
+        int rightOf = 0, leftOf = 0;
+        for (unsigned int b = 0; b <= CLUSTER_X; b++) {
+            float a = -1.0f + 2.0f * (float)b / (float)CLUSTER_X;
+            float length = std::sqrt(projection[0] * projection[0] + a * a);
+            float distance = (projection[0] * x + a * z) / length;
+            rightOf += distance > r;
+            leftOf += distance < -r;
+        }
+        int aboveOf = 0, belowOf = 0;
+        for (unsigned int b = 0; b <= CLUSTER_Y; b++) {
+            float a = -1.0f + 2.0f * (float)b / (float)CLUSTER_Y;
+            float length = std::sqrt(projection[5] * projection[5] + a * a);
+            float distance = (projection[5] * y + a * z) / length;
+            aboveOf += distance > r;
+            belowOf += distance < -r;
+        }
+
+        // Kenardaki ışıklarda sayım ızgaranın bir dışını verebilir - aralık ızgaraya kırpılır
+        minX[i] = std::max(rightOf - 1, 0);
+        maxX[i] = std::min((int)CLUSTER_X - leftOf, (int)CLUSTER_X - 1);
+        minY[i] = std::max(aboveOf - 1, 0);
+        maxY[i] = std::min((int)CLUSTER_Y - belowOf, (int)CLUSTER_Y - 1);
+
+        float depth = -z;
+        bool visible = depth + r > nearPlane && depth - r < farPlane &&
+                       minX[i] <= maxX[i] && minX[i] < (int)CLUSTER_X && maxX[i] >= 0 &&
+                       minY[i] <= maxY[i] && minY[i] < (int)CLUSTER_Y && maxY[i] >= 0;
+        if (visible) {
+            minZ[i] = depthSlice(std::max(depth - r, nearPlane), scale, bias);
+            maxZ[i] = depthSlice(std::min(depth + r, farPlane), scale, bias);
+        } else {
+            minZ[i] = 1;
+            maxZ[i] = 0;
+        }
+    }
+}
+
+void ClusteredLights::computeBoundsSimd(size_t begin, size_t end, const float* view, const float* projection,
+                                        float nearPlane, float farPlane) {
+#if CLUSTER_SIMD
+    const float scale = (float)CLUSTER_Z / std::log(farPlane / nearPlane);
+    const float bias = -scale * std::log(nearPlane);
+
+    // Sınır düzlemlerinin normalize katsayıları - tüm ışıklar için ortak
+    float columnX[CLUSTER_X + 1], columnZ[CLUSTER_X + 1];
+    for (unsigned int b = 0; b <= CLUSTER_X; b++) {
+        float a = -1.0f + 2.0f * (float)b / (float)CLUSTER_X;
+        float length = std::sqrt(projection[0] * projection[0] + a * a);
+        columnX[b] = projection[0] / length;
+        columnZ[b] = a / length;
+    }
+    float rowY[CLUSTER_Y + 1], rowZ[CLUSTER_Y + 1];
+    for (unsigned int b = 0; b <= CLUSTER_Y; b++) {
+        float a = -1.0f + 2.0f * (float)b / (float)CLUSTER_Y;
+        float length = std::sqrt(projection[5] * projection[5] + a * a);
+        rowY[b] = projection[5] / length;
+        rowZ[b] = a / length;
+    }
+
+    // begin/end 4'ün katıdır; her adımda 4 ışık birlikte işlenir
+    for (size_t i = begin; i < end; i += 4) {
+        __m128 wx = _mm_loadu_ps(&positionX[i]);
+        __m128 wy = _mm_loadu_ps(&positionY[i]);
+        __m128 wz = _mm_loadu_ps(&positionZ[i]);
+        __m128 r = _mm_loadu_ps(&radii[i]);
+        __m128 negativeR = _mm_sub_ps(_mm_setzero_ps(), r);
+
+        __m128 x = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(view[0]), wx), _mm_mul_ps(_mm_set1_ps(view[4]), wy)),
+                              _mm_add_ps(_mm_mul_ps(_mm_set1_ps(view[8]), wz), _mm_set1_ps(view[12])));
+        __m128 y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(view[1]), wx), _mm_mul_ps(_mm_set1_ps(view[5]), wy)),
+                              _mm_add_ps(_mm_mul_ps(_mm_set1_ps(view[9]), wz), _mm_set1_ps(view[13])));
+        __m128 z = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(view[2]), wx), _mm_mul_ps(_mm_set1_ps(view[6]), wy)),
+                              _mm_add_ps(_mm_mul_ps(_mm_set1_ps(view[10]), wz), _mm_set1_ps(view[14])));
+
+        // Karşılaştırma maskeleri -1 olduğundan çıkarma sayacı artırır
+        __m128i rightOf = _mm_setzero_si128(), leftOf = _mm_setzero_si128();
+        for (unsigned int b = 0; b <= CLUSTER_X; b++) {
+            __m128 distance = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(columnX[b]), x), _mm_mul_ps(_mm_set1_ps(columnZ[b]), z));
+            rightOf = _mm_sub_epi32(rightOf, _mm_castps_si128(_mm_cmpgt_ps(distance, r)));
+            leftOf = _mm_sub_epi32(leftOf, _mm_castps_si128(_mm_cmplt_ps(distance, negativeR)));
+        }
+        __m128i aboveOf = _mm_setzero_si128(), belowOf = _mm_setzero_si128();
+        for (unsigned int b = 0; b <= CLUSTER_Y; b++) {
+            __m128 distance = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(rowY[b]), y), _mm_mul_ps(_mm_set1_ps(rowZ[b]), z));
+            aboveOf = _mm_sub_epi32(aboveOf, _mm_castps_si128(_mm_cmpgt_ps(distance, r)));
+            belowOf = _mm_sub_epi32(belowOf, _mm_castps_si128(_mm_cmplt_ps(distance, negativeR)));
+        }
+
+        alignas(16) int right[4], left[4], above[4], below[4];
+        alignas(16) float depths[4], radius[4];
+        _mm_store_si128((__m128i*)right, rightOf);
+        _mm_store_si128((__m128i*)left, leftOf);
+        _mm_store_si128((__m128i*)above, aboveOf);
+        _mm_store_si128((__m128i*)below, belowOf);
+        _mm_store_ps(depths, _mm_sub_ps(_mm_setzero_ps(), z));
+        _mm_store_ps(radius, r);
+
+        // Logaritma içeren Z aralığı ve doldurma şeritleri skaler
+        for (size_t lane = 0; lane < 4 && i + lane < lights.size(); lane++) {
+            size_t l = i + lane;
+            minX[l] = std::max(right[lane] - 1, 0);
+            maxX[l] = std::min((int)CLUSTER_X - left[lane], (int)CLUSTER_X - 1);
+            minY[l] = std::max(above[lane] - 1, 0);
+            maxY[l] = std::min((int)CLUSTER_Y - below[lane], (int)CLUSTER_Y - 1);
+
+            float depth = depths[lane];
+            float rl = radius[lane];
+            bool visible = depth + rl > nearPlane && depth - rl < farPlane &&
+                           minX[l] <= maxX[l] && minX[l] < (int)CLUSTER_X && maxX[l] >= 0 &&
+                           minY[l] <= maxY[l] && minY[l] < (int)CLUSTER_Y && maxY[l] >= 0;
+            if (visible) {
+                minZ[l] = depthSlice(std::max(depth - rl, nearPlane), scale, bias);
+                maxZ[l] = depthSlice(std::min(depth + rl, farPlane), scale, bias);
+            } else {
+                minZ[l] = 1;
+                maxZ[l] = 0;
+            }
+        }
+    }
+#else
+    computeBoundsScalar(begin, std::min(end, lights.size()), view, projection, nearPlane, farPlane);
+#endif
+}
+
+bool ClusteredLights::simdAvailable() {
+    return CLUSTER_SIMD != 0;
+}
+
+void ClusteredLights::build(const float* view, const float* projection, float nearPlane, float farPlane, int width, int height) {
+    auto start = std::chrono::steady_clock::now();
+    const unsigned int threads = Parallel::workerCount();
+    const size_t count = lights.size();
+
+    // 1. Işık başına küme aralıkları - 4 ışıklık bloklar halinde paralel
+    size_t blocks = (count + 3) / 4;
+    bool simd = useSimd && simdAvailable();
+    Parallel::forRange(blocks, threads, [&](size_t begin, size_t end, unsigned int) {
+        if (simd) {
+            computeBoundsSimd(begin * 4, end * 4, view, projection, nearPlane, farPlane);
+        } else {
+            computeBoundsScalar(begin * 4, std::min(end * 4, count), view, projection, nearPlane, farPlane);
+        }
+    });
+
+    // 2. Z dilimleri iş parçacıklarına bölünür - her küme listesine tek bir iş parçacığı yazar
+    Parallel::forRange(CLUSTER_Z, threads, [&](size_t begin, size_t end, unsigned int) {
+        for (size_t slice = begin; slice < end; slice++) {
+            const int z = (int)slice;
+            for (unsigned int c = 0; c < CLUSTER_X * CLUSTER_Y; c++) {
+                clusterLights[slice * CLUSTER_X * CLUSTER_Y + c].clear();
+            }
+            for (size_t l = 0; l < count; l++) {
+                if (z < minZ[l] || z > maxZ[l]) {
+                    continue;
+                }
+                for (int y = minY[l]; y <= maxY[l]; y++) {
+                    size_t rowStart = (slice * CLUSTER_Y + y) * CLUSTER_X;
+                    for (int x = minX[l]; x <= maxX[l]; x++) {
+                        clusterLights[rowStart + x].push_back((uint32_t)l);
+                    }
+                }
+            }
+        }
+    });
+
+    // 3. Küme başlangıçları - buffer dokusu sınırını aşan ışıklar kırpılır
+    uint32_t running = 0;
+    lastMaxPerCluster = 0;
+    lastActiveClusters = 0;
+    for (unsigned int c = 0; c < CLUSTER_COUNT; c++) {
+        uint32_t lightsInCluster = (uint32_t)clusterLights[c].size();
+        lightsInCluster = std::min<uint32_t>(lightsInCluster, (uint32_t)maxBufferTexels - running);
+        grid[c * 2] = running;
+        grid[c * 2 + 1] = lightsInCluster;
+        running += lightsInCluster;
+        lastMaxPerCluster = std::max(lastMaxPerCluster, lightsInCluster);
+        lastActiveClusters += lightsInCluster > 0;
+    }
+    indices.resize(running);
+    Parallel::forRange(CLUSTER_COUNT, threads, [&](size_t begin, size_t end, unsigned int) {
+        for (size_t c = begin; c < end; c++) {
+            std::copy(clusterLights[c].begin(), clusterLights[c].begin() + grid[c * 2 + 1], indices.begin() + grid[c * 2]);
+        }
+    });
+    lastIndexCount = running;
+
+    auto stop = std::chrono::steady_clock::now();
+    lastBinMs = std::chrono::duration<float, std::milli>(stop - start).count();
+
+    // Shader'ın küme indeksini bulması için parametreler
+    depthScale = (float)CLUSTER_Z / std::log(farPlane / nearPlane);
+    depthBias = -depthScale * std::log(nearPlane);
+    tileWidth = (float)width / (float)CLUSTER_X;
+    tileHeight = (float)height / (float)CLUSTER_Y;
+
+    // Yükleme - tamponlar yetim bırakılır, sürücü önceki karenin okumasını beklemez
+    glBindBuffer(GL_TEXTURE_BUFFER, gridBuffer);
+    glBufferData(GL_TEXTURE_BUFFER, grid.size() * sizeof(uint32_t), grid.data(), GL_STREAM_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, indexBuffer);
+    glBufferData(GL_TEXTURE_BUFFER, std::max<size_t>(indices.size(), 1) * sizeof(uint32_t),
+                 indices.empty() ? NULL : indices.data(), GL_STREAM_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, lightBuffer);
+    glBufferData(GL_TEXTURE_BUFFER, std::max<size_t>(lightTexels.size(), 4) * sizeof(float),
+                 lightTexels.empty() ? NULL : lightTexels.data(), GL_STREAM_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+}
+
+void ClusteredLights::apply(const Shader& shader) const {
+    shader.setVec2("clusterTileSize", tileWidth, tileHeight);
+    shader.setFloat("clusterDepthScale", depthScale);
+    shader.setFloat("clusterDepthBias", depthBias);
+
+    const int units[] = { CLUSTER_GRID_TEXTURE_UNIT, LIGHT_INDEX_TEXTURE_UNIT, LIGHT_DATA_TEXTURE_UNIT };
+    const unsigned int textures[] = { gridTexture, indexTexture, lightTexture };
+    for (int i = 0; i < 3; i++) {
+        glActiveTexture(GL_TEXTURE0 + units[i]);
+        glBindTexture(GL_TEXTURE_BUFFER, textures[i]);
+    }
+    glActiveTexture(GL_TEXTURE0);
+}
+
+void ClusteredLights::destroy() {
+    glDeleteTextures(1, &gridTexture);
+    glDeleteTextures(1, &indexTexture);
+    glDeleteTextures(1, &lightTexture);
+    glDeleteBuffers(1, &gridBuffer);
+    glDeleteBuffers(1, &indexBuffer);
+    glDeleteBuffers(1, &lightBuffer);
+    gridTexture = indexTexture = lightTexture = 0;
+    gridBuffer = indexBuffer = lightBuffer = 0;
+}
+
+void runClusteredLightsBenchmark(ClusteredLights& clustered, const float* view, const float* projection,
+                                 float nearPlane, float farPlane, int width, int height) {
+    const int warmupFrames = 3;
+    const int measuredFrames = 30;
+    const unsigned int lightCounts[] = { 256, 1024, 4096, 16384 };
+
+    std::cout << "Kümelenmiş ışık ataması (" << CLUSTER_X << "x" << CLUSTER_Y << "x" << CLUSTER_Z << " küme, "
+              << Parallel::workerCount() << " iş parçacığı, " << measuredFrames << " kare ortalaması)" << std::endl;
+    if (!ClusteredLights::simdAvailable()) {
+        std::cout << "Not: bu derlemede SSE yok, iki sütun da skaler yolu ölçer" << std::endl;
+    }
+    std::cout << std::setw(10) << "ışık" << std::setw(14) << "skaler (ms)" << std::setw(12) << "SSE (ms)"
+              << std::setw(12) << "hızlanma" << std::setw(16) << "ort. ışık/küme" << std::setw(14) << "en fazla" << std::endl;
+
+    for (unsigned int lightCount : lightCounts) {
+        clustered.setLights(generatePointLights(lightCount, 15.0f, 11u));
+
+        double milliseconds[2] = { 0.0, 0.0 };
+        for (int mode = 0; mode < 2; mode++) {
+            clustered.useSimd = mode == 1;
+            for (int frame = 0; frame < warmupFrames + measuredFrames; frame++) {
+                clustered.animate(frame * 0.016f);
+                clustered.build(view, projection, nearPlane, farPlane, width, height);
+                if (frame >= warmupFrames) {
+                    milliseconds[mode] += clustered.lastBinMs;
+                }
+            }
+            milliseconds[mode] /= measuredFrames;
+        }
+
+        double average = clustered.lastActiveClusters > 0 ? (double)clustered.lastIndexCount / clustered.lastActiveClusters : 0.0;
+        std::cout << std::setw(10) << lightCount << std::setw(14) << std::fixed << std::setprecision(3) << milliseconds[0]
+                  << std::setw(12) << milliseconds[1] << std::setw(12) << std::setprecision(2) << milliseconds[0] / std::max(milliseconds[1], 1e-6)
+                  << std::setw(16) << average << std::setw(14) << clustered.lastMaxPerCluster << std::endl;
+    }
+    clustered.useSimd = true;
+}
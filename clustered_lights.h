@@ -0,0 +1,97 @@
+#ifndef CLUSTERED_LIGHTS_H
+#define CLUSTERED_LIGHTS_H
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <vector>
+
+#include "shader.h"
+#include "texture_units.h"
+
+// Kamera kesik piramidinin küme (froxel) ızgarası - fragment.glsl'deki CLUSTER_GRID ile eşleşir
+const unsigned int CLUSTER_X = 16;
+const unsigned int CLUSTER_Y = 9;
+const unsigned int CLUSTER_Z = 24;
+const unsigned int CLUSTER_COUNT = CLUSTER_X * CLUSTER_Y * CLUSTER_Z;
+
+// Nokta ışık
+struct PointLight {
+    float position[3]; // Dünya uzayındaki temel konum (animasyon bunun çevresinde yapılır)
+    float radius;      // Etki yarıçapı - ışık bu mesafede sıfıra iner
+    float color[3];
+    float intensity;
+};
+
+// fragment.glsl'deki tüm örnekleyicileri ayrı doku birimlerine yönlendirir
+// Farklı türde örnekleyiciler aynı birimi gösterirse çizim GL hatası verir
+void setLightingTextureUnits(Shader& shader);
+
+// Opak küp alanına dağılmış, rastgele renkli nokta ışıklar üretir
+std::vector<PointLight> generatePointLights(unsigned int count, float extent, unsigned int seed);
+
+// Kümelenmiş ileri gölgeleme (clustered forward shading) için ışık atama
+// Işıklar her karede CPU iş parçacıklarında (SSE ile, yoksa skaler) kümelere atanır;
+// küme aralıkları, ışık indeksleri ve ışık verisi buffer dokularıyla yüklenir
+class ClusteredLights {
+public:
+    bool useSimd = true;                // SSE yolu (derleyici desteklemiyorsa yok sayılır)
+    float lastBinMs = 0.0f;             // Son atamanın süresi (yükleme hariç)
+    unsigned int lastIndexCount = 0;    // Tüm kümelerdeki toplam ışık referansı
+    unsigned int lastMaxPerCluster = 0; // En kalabalık kümedeki ışık sayısı
+    unsigned int lastActiveClusters = 0; // En az bir ışık içeren küme sayısı
+
+    bool init();
+
+    void setLights(const std::vector<PointLight>& newLights);
+    unsigned int lightCount() const { return static_cast<unsigned int>(lights.size()); }
+
+    // Işıkları temel konumlarının çevresinde hareket ettirir
+    void animate(float time);
+
+    // Işıkları kameranın kümelerine atar ve buffer dokularına yükler
+    void build(const float* view, const float* projection, float nearPlane, float farPlane, int width, int height);
+
+    // Küme uniform'larını ve dokularını CLUSTERED_LIGHTS ile derlenmiş fragment.glsl programına bağlar
+    void apply(const Shader& shader) const;
+
+    // SSE yolunun bu derlemede olup olmadığı
+    static bool simdAvailable();
+
+    void destroy();
+
+private:
+    std::vector<PointLight> lights;
+
+    // Işık konumları ve yarıçapları yapı dizisi yerine dizi yapısı (SoA) - 4'ün katına doldurulur
+    std::vector<float> positionX, positionY, positionZ, radii;
+
+    // Işık başına küme aralıkları (dahil); minZ > maxZ ise ışık görünmez
+    std::vector<int> minX, maxX, minY, maxY, minZ, maxZ;
+
+    std::vector<std::vector<uint32_t>> clusterLights; // Küme başına ışık listesi
+    std::vector<uint32_t> grid;                       // Küme başına (başlangıç, sayı)
+    std::vector<uint32_t> indices;                    // Birleşik ışık indeks listesi
+    std::vector<float> lightTexels;                   // Işık başına 2 RGBA32F texel
+
+    unsigned int gridBuffer = 0, gridTexture = 0;
+    unsigned int indexBuffer = 0, indexTexture = 0;
+    unsigned int lightBuffer = 0, lightTexture = 0;
+    int maxBufferTexels = 65536;
+
+    // Son yapılandırma - apply() ile shader'a aktarılır
+    float depthScale = 0.0f;
+    float depthBias = 0.0f;
+    float tileWidth = 1.0f;
+    float tileHeight = 1.0f;
+
+    void computeBoundsScalar(size_t begin, size_t end, const float* view, const float* projection,
+                             float nearPlane, float farPlane);
+    void computeBoundsSimd(size_t begin, size_t end, const float* view, const float* projection,
+                           float nearPlane, float farPlane);
+};
+
+// Işık sayısına göre skaler ve SSE atama süresini ve küme doluluğunu ölçer ve yazdırır
+void runClusteredLightsBenchmark(ClusteredLights& clustered, const float* view, const float* projection,
+                                 float nearPlane, float farPlane, int width, int height);
+
+#endif // CLUSTERED_LIGHTS_H
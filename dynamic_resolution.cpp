@@ -0,0 +1,132 @@
+#include "dynamic_resolution.h"
+
+#include <algorithm>
+#include <cmath>
+
+void DynamicResolution::init() {
+    for (int i = 0; i < QUERY_FRAMES; i++) {
+        glGenQueries(2 * MAX_SECTIONS, queries[i][0]);
+        sectionCount[i] = 0;
+        pending[i] = false;
+    }
+    current = 0;
+    scale = enabled ? maxScale : 1.0f;
+}
+
+void DynamicResolution::beginFrame() {
+    // Sonucu hâlâ gelmemiş eski ölçüm atılır - beklemek render döngüsünü durdurur
+    pending[current] = false;
+    sectionCount[current] = 0;
+    sectionOpen = false;
+}
+
+void DynamicResolution::beginSection() {
+    if (sectionOpen || sectionCount[current] >= MAX_SECTIONS) {
+        return;
+    }
+    glQueryCounter(queries[current][sectionCount[current]][0], GL_TIMESTAMP);
+    sectionOpen = true;
+}
+
+void DynamicResolution::endSection() {
+    if (!sectionOpen) {
+        return;
+    }
+    glQueryCounter(queries[current][sectionCount[current]][1], GL_TIMESTAMP);
+    sectionCount[current]++;
+    sectionOpen = false;
+}
+
+void DynamicResolution::endFrame() {
+    endSection();
+    pending[current] = sectionCount[current] > 0;
+    queryScale[current] = effectiveScale();
+    current = (current + 1) % QUERY_FRAMES;
+    collect();
+}
+
+void DynamicResolution::collect() {
+    for (int i = 0; i < QUERY_FRAMES; i++) {
+        if (!pending[i]) {
+            continue;
+        }
+        // Zaman damgaları komut sırasıyla yazılır - son bölüm hazırsa öncekiler de hazırdır
+        GLuint available = 0;
+        glGetQueryObjectuiv(queries[i][sectionCount[i] - 1][1], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) {
+            continue;
+        }
+
+        GLuint64 frameNs = 0;
+        bool valid = true;
+        for (int section = 0; section < sectionCount[i]; section++) {
+            GLuint64 start = 0, end = 0;
+            glGetQueryObjectui64v(queries[i][section][0], GL_QUERY_RESULT, &start);
+            glGetQueryObjectui64v(queries[i][section][1], GL_QUERY_RESULT, &end);
+            valid = valid && end >= start;
+            frameNs += end - start;
+        }
+        pending[i] = false;
+        if (queryScale[i] != effectiveScale() || !valid) {
+            continue;
+        }
+        sumMs += (double)frameNs / 1e6;
+        samples++;
+    }
+
+    if (samples >= adjustInterval) {
+        lastGpuMs = (float)(sumMs / samples);
+        sumMs = 0.0;
+        samples = 0;
+        if (enabled) {
+            adjust(lastGpuMs);
+        }
+    }
+}
+
+void DynamicResolution::adjust(float averageMs) {
+    // Ölü bölge: bütçenin %85-100'ü arasında değişiklik yapılmaz, böylece ölçek iki adım arasında salınmaz
+    if (averageMs <= targetMs && averageMs >= targetMs * 0.85f) {
+        return;
+    }
+
+    // GPU süresi kabaca piksel sayısıyla, yani ölçeğin karesiyle orantılı
+    float desired = scale * std::sqrt(targetMs / std::max(averageMs, 0.01f));
+
+    // Aşağı hemen, yukarı yarım adımla - kare kaçırmak çözünürlük kaybından daha rahatsız edicidir
+    float next = averageMs > targetMs ? desired : scale + (desired - scale) * 0.5f;
+    next = std::floor(next / SCALE_STEP + 0.001f) * SCALE_STEP;
+
+    // Yuvarlama sonucu yerinde saydıysa bir adım ilerle
+    if (averageMs < targetMs && next <= scale) {
+        next = scale + SCALE_STEP;
+    } else if (averageMs > targetMs && next >= scale) {
+        next = scale - SCALE_STEP;
+    }
+    next = std::max(minScale, std::min(maxScale, next));
+
+    if (std::fabs(next - scale) > 0.001f) {
+        scale = next;
+        changes++;
+        sumMs = 0.0;
+        samples = 0;
+    }
+}
+
+void DynamicResolution::renderSize(int outputWidth, int outputHeight, int& width, int& height) const {
+    width = std::max(1, (int)(outputWidth * effectiveScale() + 0.5f));
+    height = std::max(1, (int)(outputHeight * effectiveScale() + 0.5f));
+}
+
+void DynamicResolution::destroy() {
+    for (int i = 0; i < QUERY_FRAMES; i++) {
+        if (queries[i][0][0] != 0) {
+            glDeleteQueries(2 * MAX_SECTIONS, queries[i][0]);
+        }
+        for (int section = 0; section < MAX_SECTIONS; section++) {
+            queries[i][section][0] = queries[i][section][1] = 0;
+        }
+        sectionCount[i] = 0;
+        pending[i] = false;
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef DYNAMIC_RESOLUTION_H
+#define DYNAMIC_RESOLUTION_H
+
+#include <glad/glad.h>
+#include <cstdint>
+
+// Dinamik çözünürlük - sahne hedefinin çözünürlüğü, ölçülen GPU kare süresi bütçeye yaklaşacak
+// şekilde birkaç karede bir ayarlanır; sahne pencereye doğrusal süzgeçli blit ile büyütülür.
+// Süre GPU geçişlerini çevreleyen GL_TIMESTAMP çiftlerinin toplamıdır; aradaki CPU işi (ışık ataması,
+// sıralama, doku akışı) GPU'yu boşta bırakır ve sayılmaz, böylece ölçek yalnızca GPU maliyetine tepki verir
+// (GL_TIME_ELAPSED iç içe kullanılamaz - parçacık adımı kendi süre sorgusunu kullanıyor)
+class DynamicResolution {
+public:
+    bool enabled = true;
+    float targetMs = 15.0f;           // GPU kare süresi bütçesi
+    float minScale = 0.5f;            // Eksen başına en düşük ölçek
+    float maxScale = 1.0f;
+    unsigned int adjustInterval = 10; // Ayarlar arası ölçülen kare sayısı (ölçümler ortalanır)
+
+    float scale = 1.0f;               // Güncel eksen başına ölçek (SCALE_STEP katı)
+    float lastGpuMs = 0.0f;           // Son ayar aralığının ortalama GPU kare süresi
+    unsigned int changes = 0;         // Çözünürlük değişikliği sayısı
+
+    // Ölçek adımı - küçük dalgalanmalar hedefleri her seferinde yeniden oluşturmasın
+    static constexpr float SCALE_STEP = 0.05f;
+
+    void init();
+
+    // Kare başı / sonu - aradaki ölçüm bölümleri tek bir kare süresi olarak toplanır
+    void beginFrame();
+    void endFrame();
+
+    // Bir GPU geçişini çevreleyen zaman damgası çifti (kare başına en fazla MAX_SECTIONS)
+    void beginSection();
+    void endSection();
+
+    // Kapalıyken tam çözünürlük
+    float effectiveScale() const { return enabled ? scale : 1.0f; }
+
+    // Çıkış (pencere) boyutu için sahnenin çizileceği boyut
+    void renderSize(int outputWidth, int outputHeight, int& width, int& height) const;
+
+    void destroy();
+
+private:
+    static const int QUERY_FRAMES = 3;        // Sonuçlar birkaç kare sonra beklemeden okunur
+    static const int MAX_SECTIONS = 4;
+    unsigned int queries[QUERY_FRAMES][MAX_SECTIONS][2] = {};
+    int sectionCount[QUERY_FRAMES] = {};
+    float queryScale[QUERY_FRAMES] = {};      // Ölçümün yapıldığı ölçek - eski ölçekteki kareler sayılmaz
+    bool pending[QUERY_FRAMES] = {};
+    bool sectionOpen = false;
+    unsigned int current = 0;
+    double sumMs = 0.0;
+    unsigned int samples = 0;
+
+    void collect();
+    void adjust(float averageMs);
+};
+
+#endif // DYNAMIC_RESOLUTION_H
@@ -88,6 +88,69 @@ PFNGLUNIFORM1IPROC glUniform1i;
 PFNGLUNIFORM1FPROC glUniform1f;
 PFNGLUNIFORM3FPROC glUniform3f;
 PFNGLUNIFORMMATRIX4FVPROC glUniformMatrix4fv;
+PFNGLDISABLEPROC glDisable;
+PFNGLFINISHPROC glFinish;
+PFNGLDEPTHMASKPROC glDepthMask;
+PFNGLDEPTHFUNCPROC glDepthFunc;
+PFNGLBLENDFUNCPROC glBlendFunc;
+PFNGLBLENDFUNCSEPARATEPROC glBlendFuncSeparate;
+PFNGLDRAWARRAYSPROC glDrawArrays;
+PFNGLDRAWELEMENTSINSTANCEDPROC glDrawElementsInstanced;
+PFNGLVERTEXATTRIBDIVISORPROC glVertexAttribDivisor;
+PFNGLVERTEXATTRIB4FPROC glVertexAttrib4f;
+PFNGLDISABLEVERTEXATTRIBARRAYPROC glDisableVertexAttribArray;
+PFNGLBUFFERSUBDATAPROC glBufferSubData;
+PFNGLGENTEXTURESPROC glGenTextures;
+PFNGLDELETETEXTURESPROC glDeleteTextures;
+PFNGLBINDTEXTUREPROC glBindTexture;
+PFNGLACTIVETEXTUREPROC glActiveTexture;
+PFNGLTEXIMAGE2DPROC glTexImage2D;
+PFNGLTEXPARAMETERIPROC glTexParameteri;
+PFNGLGENFRAMEBUFFERSPROC glGenFramebuffers;
+PFNGLDELETEFRAMEBUFFERSPROC glDeleteFramebuffers;
+PFNGLBINDFRAMEBUFFERPROC glBindFramebuffer;
+PFNGLFRAMEBUFFERTEXTURE2DPROC glFramebufferTexture2D;
+PFNGLCHECKFRAMEBUFFERSTATUSPROC glCheckFramebufferStatus;
+PFNGLDRAWBUFFERSPROC glDrawBuffers;
+PFNGLCLEARBUFFERFVPROC glClearBufferfv;
+PFNGLBLITFRAMEBUFFERPROC glBlitFramebuffer;
+PFNGLCOLORMASKPROC glColorMask;
+PFNGLREADPIXELSPROC glReadPixels;
+PFNGLGENQUERIESPROC glGenQueries;
+PFNGLDELETEQUERIESPROC glDeleteQueries;
+PFNGLBEGINQUERYPROC glBeginQuery;
+PFNGLENDQUERYPROC glEndQuery;
+PFNGLGETQUERYOBJECTUIVPROC glGetQueryObjectuiv;
+PFNGLTRANSFORMFEEDBACKVARYINGSPROC glTransformFeedbackVaryings;
+PFNGLBINDBUFFERBASEPROC glBindBufferBase;
+PFNGLBEGINTRANSFORMFEEDBACKPROC glBeginTransformFeedback;
+PFNGLENDTRANSFORMFEEDBACKPROC glEndTransformFeedback;
+PFNGLMAPBUFFERRANGEPROC glMapBufferRange;
+PFNGLUNMAPBUFFERPROC glUnmapBuffer;
+PFNGLUNIFORM2IPROC glUniform2i;
+PFNGLUNIFORM2FPROC glUniform2f;
+PFNGLUNIFORM4FPROC glUniform4f;
+PFNGLSCISSORPROC glScissor;
+PFNGLGETUNIFORMBLOCKINDEXPROC glGetUniformBlockIndex;
+PFNGLUNIFORMBLOCKBINDINGPROC glUniformBlockBinding;
+PFNGLREADBUFFERPROC glReadBuffer;
+PFNGLTEXIMAGE3DPROC glTexImage3D;
+PFNGLFRAMEBUFFERTEXTURELAYERPROC glFramebufferTextureLayer;
+PFNGLPOLYGONOFFSETPROC glPolygonOffset;
+PFNGLTEXBUFFERPROC glTexBuffer;
+PFNGLGETINTEGERVPROC glGetIntegerv;
+PFNGLFENCESYNCPROC glFenceSync;
+PFNGLCLIENTWAITSYNCPROC glClientWaitSync;
+PFNGLDELETESYNCPROC glDeleteSync;
+PFNGLGETBUFFERSUBDATAPROC glGetBufferSubData;
+PFNGLPOINTSIZEPROC glPointSize;
+PFNGLQUERYCOUNTERPROC glQueryCounter;
+PFNGLGETQUERYOBJECTUI64VPROC glGetQueryObjectui64v;
+PFNGLGETSTRINGIPROC glGetStringi;
+PFNGLCOMPRESSEDTEXIMAGE2DPROC glCompressedTexImage2D;
+PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glMaxShaderCompilerThreadsKHR;
+PFNGLMAXSHADERCOMPILERTHREADSARBPROC glMaxShaderCompilerThreadsARB;
+PFNGLDELETEPROGRAMPROC glDeleteProgram;
 
 /* GLAD başlatma fonksiyonu */
 int gladLoadGLLoader(GLADloadproc load) {
@@ -134,6 +197,69 @@ int gladLoadGLLoader(GLADloadproc load) {
     glUniform1f = (PFNGLUNIFORM1FPROC)load("glUniform1f");
     glUniform3f = (PFNGLUNIFORM3FPROC)load("glUniform3f");
     glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)load("glUniformMatrix4fv");
+    glDisable = (PFNGLDISABLEPROC)load("glDisable");
+    glFinish = (PFNGLFINISHPROC)load("glFinish");
+    glDepthMask = (PFNGLDEPTHMASKPROC)load("glDepthMask");
+    glDepthFunc = (PFNGLDEPTHFUNCPROC)load("glDepthFunc");
+    glBlendFunc = (PFNGLBLENDFUNCPROC)load("glBlendFunc");
+    glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)load("glBlendFuncSeparate");
+    glDrawArrays = (PFNGLDRAWARRAYSPROC)load("glDrawArrays");
+    glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)load("glDrawElementsInstanced");
+    glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)load("glVertexAttribDivisor");
+    glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)load("glVertexAttrib4f");
+    glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)load("glDisableVertexAttribArray");
+    glBufferSubData = (PFNGLBUFFERSUBDATAPROC)load("glBufferSubData");
+    glGenTextures = (PFNGLGENTEXTURESPROC)load("glGenTextures");
+    glDeleteTextures = (PFNGLDELETETEXTURESPROC)load("glDeleteTextures");
+    glBindTexture = (PFNGLBINDTEXTUREPROC)load("glBindTexture");
+    glActiveTexture = (PFNGLACTIVETEXTUREPROC)load("glActiveTexture");
+    glTexImage2D = (PFNGLTEXIMAGE2DPROC)load("glTexImage2D");
+    glTexParameteri = (PFNGLTEXPARAMETERIPROC)load("glTexParameteri");
+    glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)load("glGenFramebuffers");
+    glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)load("glDeleteFramebuffers");
+    glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)load("glBindFramebuffer");
+    glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)load("glFramebufferTexture2D");
+    glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)load("glCheckFramebufferStatus");
+    glDrawBuffers = (PFNGLDRAWBUFFERSPROC)load("glDrawBuffers");
+    glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)load("glClearBufferfv");
+    glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)load("glBlitFramebuffer");
+    glColorMask = (PFNGLCOLORMASKPROC)load("glColorMask");
+    glReadPixels = (PFNGLREADPIXELSPROC)load("glReadPixels");
+    glGenQueries = (PFNGLGENQUERIESPROC)load("glGenQueries");
+    glDeleteQueries = (PFNGLDELETEQUERIESPROC)load("glDeleteQueries");
+    glBeginQuery = (PFNGLBEGINQUERYPROC)load("glBeginQuery");
+    glEndQuery = (PFNGLENDQUERYPROC)load("glEndQuery");
+    glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)load("glGetQueryObjectuiv");
+    glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)load("glTransformFeedbackVaryings");
+    glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)load("glBindBufferBase");
+    glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)load("glBeginTransformFeedback");
+    glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)load("glEndTransformFeedback");
+    glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)load("glMapBufferRange");
+    glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)load("glUnmapBuffer");
+    glUniform2i = (PFNGLUNIFORM2IPROC)load("glUniform2i");
+    glUniform2f = (PFNGLUNIFORM2FPROC)load("glUniform2f");
+    glUniform4f = (PFNGLUNIFORM4FPROC)load("glUniform4f");
+    glScissor = (PFNGLSCISSORPROC)load("glScissor");
+    glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)load("glGetUniformBlockIndex");
+    glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)load("glUniformBlockBinding");
+    glReadBuffer = (PFNGLREADBUFFERPROC)load("glReadBuffer");
+    glTexImage3D = (PFNGLTEXIMAGE3DPROC)load("glTexImage3D");
+    glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)load("glFramebufferTextureLayer");
+    glPolygonOffset = (PFNGLPOLYGONOFFSETPROC)load("glPolygonOffset");
+    glTexBuffer = (PFNGLTEXBUFFERPROC)load("glTexBuffer");
+    glGetIntegerv = (PFNGLGETINTEGERVPROC)load("glGetIntegerv");
+    glFenceSync = (PFNGLFENCESYNCPROC)load("glFenceSync");
+    glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)load("glClientWaitSync");
+    glDeleteSync = (PFNGLDELETESYNCPROC)load("glDeleteSync");
+    glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)load("glGetBufferSubData");
+    glPointSize = (PFNGLPOINTSIZEPROC)load("glPointSize");
+    glQueryCounter = (PFNGLQUERYCOUNTERPROC)load("glQueryCounter");
+    glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)load("glGetQueryObjectui64v");
+    glGetStringi = (PFNGLGETSTRINGIPROC)load("glGetStringi");
+    glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)load("glCompressedTexImage2D");
+    glMaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)load("glMaxShaderCompilerThreadsKHR");
+    glMaxShaderCompilerThreadsARB = (PFNGLMAXSHADERCOMPILERTHREADSARBPROC)load("glMaxShaderCompilerThreadsARB");
+    glDeleteProgram = (PFNGLDELETEPROGRAMPROC)load("glDeleteProgram");
     
     /* Yükleme başarılı mı kontrol et - temel fonksiyonlar */
     if(glClear == NULL || glClearColor == NULL || glViewport == NULL) {
@@ -0,0 +1,172 @@
+#include "input.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+uint64_t inputClockNs() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool InputRecorder::open(const std::string& path) {
+    file.open(path);
+    if (!file.is_open()) {
+        std::cerr << "HATA: Girdi kayıt dosyası açılamadı: " << path << std::endl;
+        return false;
+    }
+    file << "# kare tür tuş x y" << std::endl;
+    file << std::setprecision(17);
+    return true;
+}
+
+void InputRecorder::write(uint64_t frame, const InputEvent& event) {
+    file << frame << " " << static_cast<int>(event.type) << " " << event.key << " "
+         << event.x << " " << event.y << "\n";
+}
+
+void InputRecorder::close() {
+    if (file.is_open()) {
+        file.close();
+    }
+}
+
+bool InputReplay::load(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "HATA: Girdi kayıt dosyası okunamadı: " << path << std::endl;
+        return false;
+    }
+
+    events.clear();
+    cursor = 0;
+    lastFrame = 0;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream stream(line);
+        uint64_t frame;
+        int type;
+        InputEvent event;
+        if (!(stream >> frame >> type >> event.key >> event.x >> event.y) ||
+            type < 0 || type > static_cast<int>(InputEventType::Resize)) {
+            std::cerr << "HATA: Bozuk girdi kaydı satırı: " << line << std::endl;
+            return false;
+        }
+        event.type = static_cast<InputEventType>(type);
+        event.timestamp = 0;
+        events.push_back(std::make_pair(frame, event));
+        lastFrame = std::max(lastFrame, frame);
+    }
+
+    // Kayıt kare sırasıyla yazılır; yine de elle düzenlenmiş dosyalar için sırala
+    std::stable_sort(events.begin(), events.end(),
+                     [](const std::pair<uint64_t, InputEvent>& a, const std::pair<uint64_t, InputEvent>& b) {
+                         return a.first < b.first;
+                     });
+    return true;
+}
+
+void InputReplay::eventsForFrame(uint64_t frame, std::vector<InputEvent>& out) {
+    uint64_t now = inputClockNs();
+    while (cursor < events.size() && events[cursor].first <= frame) {
+        InputEvent event = events[cursor].second;
+        event.timestamp = now;
+        out.push_back(event);
+        cursor++;
+    }
+}
+
+void LatencyTracker::eventConsumed(uint64_t timestamp) {
+    // Toplam ilk olaya göre tutulur - mutlak nanosaniyeler toplanırsa taşabilir
+    if (frameCount == 0) {
+        frameFirst = timestamp;
+        frameOldest = timestamp;
+    }
+    frameOldest = std::min(frameOldest, timestamp);
+    frameOffsetSum += (double)(int64_t)(timestamp - frameFirst);
+    frameCount++;
+}
+
+void LatencyTracker::frameSubmitted() {
+    if (fence != 0) {
+        glDeleteSync(fence);
+    }
+    fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    pendingFirst = frameFirst;
+    pendingOffsetSum = frameOffsetSum;
+    pendingOldest = frameOldest;
+    pendingCount = frameCount;
+    frameOffsetSum = 0.0;
+    frameCount = 0;
+}
+
+void LatencyTracker::waitPreviousFrame(double refreshPeriodMs) {
+    if (fence == 0) {
+        return;
+    }
+
+    // En fazla 100 ms bekle - takılan bir sürücü render döngüsünü kilitlemesin
+    GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 100000000ull);
+    uint64_t done = inputClockNs();
+    glDeleteSync(fence);
+    fence = 0;
+
+    if (pendingCount == 0 || result == GL_TIMEOUT_EXPIRED || result == GL_WAIT_FAILED) {
+        return;
+    }
+
+    // Ortalama olay anı = ilk olay + ortalama kayma
+    double scanoutMs = refreshPeriodMs * 0.5;
+    double oldestMs = (double)(int64_t)(done - pendingOldest) / 1e6 + scanoutMs;
+    double averageMs = (double)(int64_t)(done - pendingFirst) / 1e6 - pendingOffsetSum / pendingCount / 1e6 + scanoutMs;
+
+    sumMs += averageMs * pendingCount;
+    samples += pendingCount;
+    worst = std::max(worst, oldestMs);
+}
+
+void LatencyTracker::reset() {
+    sumMs = 0.0;
+    worst = 0.0;
+    samples = 0;
+}
+
+void LatencyTracker::destroy() {
+    if (fence != 0) {
+        glDeleteSync(fence);
+        fence = 0;
+    }
+}
+
+void printReplaySummary(std::vector<float> frameTimes, const LatencyTracker& latency) {
+    if (frameTimes.empty()) {
+        return;
+    }
+
+    double total = 0.0;
+    for (float frameMs : frameTimes) {
+        total += frameMs;
+    }
+    std::sort(frameTimes.begin(), frameTimes.end());
+    auto percentile = [&](double p) {
+        size_t index = std::min(frameTimes.size() - 1, (size_t)(p * (frameTimes.size() - 1) + 0.5));
+        return frameTimes[index];
+    };
+
+    std::cout << "Tekrar tamamlandı: " << frameTimes.size() << " kare" << std::endl;
+    std::cout << std::fixed << std::setprecision(3)
+              << std::setw(14) << "ortalama (ms)" << std::setw(12) << "p50 (ms)" << std::setw(12) << "p95 (ms)"
+              << std::setw(12) << "p99 (ms)" << std::setw(14) << "en kötü (ms)" << std::endl;
+    std::cout << std::setw(14) << total / frameTimes.size() << std::setw(12) << percentile(0.50)
+              << std::setw(12) << percentile(0.95) << std::setw(12) << percentile(0.99)
+              << std::setw(14) << frameTimes.back() << std::endl;
+    if (latency.sampleCount() > 0) {
+        std::cout << "Olay tüketiminden ekrana (tahmini): ort. " << latency.averageMs() << " ms, en kötü "
+                  << latency.worstMs() << " ms" << std::endl;
+    }
+}
@@ -0,0 +1,112 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "spsc_queue.h"
+
+// Girdi olayı türleri
+enum class InputEventType {
+    KeyPress,
+    KeyRelease,
+    CursorMove,
+    Scroll,
+    Resize
+};
+
+// Zaman damgalı girdi olayı - GLFW callback'lerinde üretilir, simülasyon tarafından tüketilir
+struct InputEvent {
+    InputEventType type;
+    int key;            // KeyPress / KeyRelease için GLFW tuş kodu
+    double x;           // İmleç x, tekerlek x ofseti veya framebuffer genişliği
+    double y;           // İmleç y, tekerlek y ofseti veya framebuffer yüksekliği
+    uint64_t timestamp; // inputClockNs() cinsinden üretilme anı
+};
+
+// Girdi olayları için tekdüze saat (nanosaniye)
+uint64_t inputClockNs();
+
+// Girdi iş parçacığından (GLFW ana iş parçacığı) render iş parçacığına olay kuyruğu
+typedef SpscQueue<InputEvent, 4096> InputQueue;
+
+// Tüketilen olayları kare numarasıyla birlikte metin dosyasına yazar
+class InputRecorder {
+public:
+    bool open(const std::string& path);
+    bool isOpen() const { return file.is_open(); }
+    void write(uint64_t frame, const InputEvent& event);
+    void close();
+
+private:
+    std::ofstream file;
+};
+
+// Kaydedilmiş olay akışını aynı kare numaralarında yeniden üretir
+class InputReplay {
+public:
+    bool load(const std::string& path);
+
+    // frame karesinde tüketilecek olayları out'a ekler; zaman damgası tüketim anına ayarlanır
+    void eventsForFrame(uint64_t frame, std::vector<InputEvent>& out);
+
+    // Kayıttaki son kare geçildiyse true
+    bool finished(uint64_t frame) const { return frame > lastFrame; }
+    size_t eventCount() const { return events.size(); }
+
+private:
+    std::vector<std::pair<uint64_t, InputEvent>> events;
+    size_t cursor = 0;
+    uint64_t lastFrame = 0;
+};
+
+// Girdiden ekrana gecikme tahmini
+// Her karede tüketilen olayların zaman damgaları karenin çit (fence) nesnesiyle eşlenir; bir sonraki
+// karenin başında çit beklenir ve GPU'nun kareyi bitirdiği an ile olay anları arasındaki fark ölçülür.
+// Görüntünün ekrana çıkması için ortalama yarım yenileme süresi eklenir.
+// Çitin beklenmesi sürücünün önden kare biriktirmesini de engeller (kuyruktaki kareler gecikmeye eklenir)
+class LatencyTracker {
+public:
+    float averageMs() const { return samples > 0 ? (float)(sumMs / samples) : 0.0f; }
+    float worstMs() const { return (float)worst; }
+    unsigned int sampleCount() const { return samples; }
+
+    // Bu karede tüketilen bir olayı kaydet
+    void eventConsumed(uint64_t timestamp);
+
+    // Kare gönderildikten sonra (swap) çağrılır
+    void frameSubmitted();
+
+    // Bir önceki karenin GPU'da bitmesini bekler ve örnekleri ekler
+    void waitPreviousFrame(double refreshPeriodMs);
+
+    void reset();
+    void destroy();
+
+private:
+    GLsync fence = 0;
+
+    // Gönderilen (çiti beklenen) karedeki olaylar
+    uint64_t pendingFirst = 0;
+    uint64_t pendingOldest = 0;
+    double pendingOffsetSum = 0.0; // İlk olaya göre kaymaların toplamı (ortalama için)
+    unsigned int pendingCount = 0;
+
+    // Kaydedilmekte olan karedeki olaylar
+    uint64_t frameFirst = 0;
+    uint64_t frameOldest = 0;
+    double frameOffsetSum = 0.0;
+    unsigned int frameCount = 0;
+
+    double sumMs = 0.0;
+    double worst = 0.0;
+    unsigned int samples = 0;
+};
+
+// Tekrar sonunda kare süresi dağılımını ve gecikme tahminini yazdırır
+void printReplaySummary(std::vector<float> frameTimes, const LatencyTracker& latency);
+
+#endif // INPUT_H
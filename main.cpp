@@ -2,16 +2,43 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 #include <iostream>
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
+#include "shader.h"
+#include "matrix_utils.h"
+#include "render_target.h"
+#include "scene.h"
+#include "transparency.h"
+#include "occlusion.h"
+#include "multiview.h"
+#include "shadows.h"
+#include "clustered_lights.h"
+#include "input.h"
+#include "particles.h"
+#include "texture_streaming.h"
+#include "dynamic_resolution.h"
+#include "shader_permutations.h"
+
 // Pencere boyutları
 const unsigned int SCR_WIDTH = 800;
 const unsigned int SCR_HEIGHT = 600;
 
+// Shader dosyalarının bulunduğu dizin
+const std::string SHADER_DIR = "/home/mrbasaran/Documents/projects/playground/opengl-claude-code-test/shaders/";
+
+// Güncel framebuffer boyutu (callback tarafından güncellenir)
+int framebufferWidth = SCR_WIDTH;
+int framebufferHeight = SCR_HEIGHT;
+
 // Kamera değişkenleri
 float cameraRadius = 3.0f;
 float cameraHeight = 0.0f;
@@ -28,232 +55,198 @@ float lastY = SCR_HEIGHT / 2.0f;
 float yaw = -90.0f;  // Yaw, Y ekseninde dönüş
 float pitch = 0.0f;  // Pitch, X ekseninde dönüş
 
-// Shader sınıfı - shader programını yükleme ve kullanma fonksiyonlarını içerir
-class Shader {
-public:
-    unsigned int ID; // Program ID
-    
-    // Constructor - shader dosyalarını okur ve derler
-    Shader(const char* vertexPath, const char* fragmentPath) {
-        // 1. Shader dosyalarını oku
-        std::string vertexCode;
-        std::string fragmentCode;
-        std::ifstream vShaderFile;
-        std::ifstream fShaderFile;
-        
-        // İstisna fırlatmayı etkinleştir
-        vShaderFile.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-        fShaderFile.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-        
-        try {
-            // Dosyaları aç
-            vShaderFile.open(vertexPath);
-            fShaderFile.open(fragmentPath);
-            std::stringstream vShaderStream, fShaderStream;
-            
-            // Akışlardan oku
-            vShaderStream << vShaderFile.rdbuf();
-            fShaderStream << fShaderFile.rdbuf();
-            
-            // Dosyaları kapat
-            vShaderFile.close();
-            fShaderFile.close();
-            
-            // Akışları string'e dönüştür
-            vertexCode = vShaderStream.str();
-            fragmentCode = fShaderStream.str();
-        } catch (std::ifstream::failure& e) {
-            std::cerr << "HATA: Shader dosyası okunamadı" << std::endl;
-        }
-        
-        const char* vShaderCode = vertexCode.c_str();
-        const char* fShaderCode = fragmentCode.c_str();
-        
-        // 2. Shader'ları derle
-        unsigned int vertex, fragment;
-        int success;
-        char infoLog[512];
-        
-        // Vertex Shader
-        vertex = glCreateShader(GL_VERTEX_SHADER);
-        glShaderSource(vertex, 1, &vShaderCode, NULL);
-        glCompileShader(vertex);
-        
-        // Derleme hatalarını kontrol et
-        glGetShaderiv(vertex, GL_COMPILE_STATUS, &success);
-        if (!success) {
-            glGetShaderInfoLog(vertex, 512, NULL, infoLog);
-            std::cerr << "HATA: Vertex shader derleme hatası\n" << infoLog << std::endl;
-        }
-        
-        // Fragment Shader
-        fragment = glCreateShader(GL_FRAGMENT_SHADER);
-        glShaderSource(fragment, 1, &fShaderCode, NULL);
-        glCompileShader(fragment);
-        
-        // Derleme hatalarını kontrol et
-        glGetShaderiv(fragment, GL_COMPILE_STATUS, &success);
-        if (!success) {
-            glGetShaderInfoLog(fragment, 512, NULL, infoLog);
-            std::cerr << "HATA: Fragment shader derleme hatası\n" << infoLog << std::endl;
-        }
-        
-        // Shader programı
-        ID = glCreateProgram();
-        glAttachShader(ID, vertex);
-        glAttachShader(ID, fragment);
-        glLinkProgram(ID);
-        
-        // Bağlama hatalarını kontrol et
-        glGetProgramiv(ID, GL_LINK_STATUS, &success);
-        if (!success) {
-            glGetProgramInfoLog(ID, 512, NULL, infoLog);
-            std::cerr << "HATA: Shader programı bağlama hatası\n" << infoLog << std::endl;
+// Saydam küp çizim yöntemi (T tuşu ile değiştirilir)
+TransparencyMode transparencyMode = TransparencyMode::WeightedOIT;
+
+// Opak küp alanı: derinlik ön geçişi (P tuşu) ve oklüzyon eleme yöntemi (O tuşu)
+bool depthPrepass = true;
+CullingMode cullingMode = CullingMode::GPU;
+
+// Çoklu görünüm modu (V tuşu) - 2x2 kamera ızgarası ve yardımcı derinlik kamerası
+bool multiViewMode = false;
+
+// Gölge kademesi sayısı (K tuşu ile 0-4 arasında değiştirilir, 0 gölgeleri kapatır)
+unsigned int shadowCascadeCount = 3;
+
+// Kümelenmiş nokta ışıkları (L tuşu)
+bool clusteredLighting = true;
+
+// GPU parçacıkları (G tuşu ile kapalı / nokta / küp)
+ParticleMode particleMode = ParticleMode::Off;
+
+// Doku kaplanmış küpler ve doku akışı (X tuşu)
+bool texturedCubesEnabled = true;
+
+// Dinamik çözünürlük (D tuşu) - sahne GPU kare süresi bütçesine göre düşük çözünürlükte çizilip büyütülür
+bool dynamicResolutionEnabled = true;
+
+// Hata ayıklama görünümü (C tuşu) - 0 kapalı, 1-3 normaller / konum / ekran koordinatları
+unsigned int debugView = 0;
+
+// Sahne shader'ı maskeleri - çizim yolu maskeleri yalnızca sceneShaderFeatures() ile alır,
+// böylece isteyebileceği her birleşim aşağıdaki static_assert ile derleme zamanında denetlenir
+enum class SceneDraw { Single, Instanced, Textured };
+
+// Temel özellikler: 0-3 aydınlatma (bit 0 gölge, bit 1 nokta ışık), 4-6 hata ayıklama görünümleri
+const unsigned int SCENE_LIGHTING_BASES = 4;
+const unsigned int SCENE_BASE_COUNT = 7;
+
+constexpr uint32_t sceneBaseFeatures(unsigned int base) {
+    const uint32_t debugViews[] = { ShaderFeature::DebugNormals, ShaderFeature::DebugPosition, ShaderFeature::DebugScreen };
+    if (base >= SCENE_LIGHTING_BASES)
+        return debugViews[base - SCENE_LIGHTING_BASES];
+    return ShaderFeature::Lighting | ((base & 1) ? ShaderFeature::Shadows : 0u) |
+           ((base & 2) ? ShaderFeature::ClusteredLights : 0u);
+}
+
+constexpr uint32_t sceneShaderFeatures(unsigned int base, SceneDraw draw) {
+    uint32_t features = sceneBaseFeatures(base);
+    if (draw != SceneDraw::Single)
+        features |= ShaderFeature::Instancing;
+    // Hata ayıklama görünümleri dokuyu kullanmaz
+    if (draw == SceneDraw::Textured && base < SCENE_LIGHTING_BASES)
+        features |= ShaderFeature::AlbedoTexture;
+    return features;
+}
+
+constexpr bool allSceneShaderFeaturesValid() {
+    const SceneDraw draws[] = { SceneDraw::Single, SceneDraw::Instanced, SceneDraw::Textured };
+    for (unsigned int base = 0; base < SCENE_BASE_COUNT; base++) {
+        for (SceneDraw draw : draws) {
+            if (!validShaderFeatures(sceneShaderFeatures(base, draw)))
+                return false;
         }
-        
-        // Artık bağlandıkları için shader nesnelerini sil
-        glDeleteShader(vertex);
-        glDeleteShader(fragment);
-    }
-    
-    // Programı aktif et
-    void use() {
-        glUseProgram(ID);
-    }
-    
-    // Uniform değişkenlerini ayarla
-    void setBool(const std::string &name, bool value) const {
-        glUniform1i(glGetUniformLocation(ID, name.c_str()), (int)value);
-    }
-    
-    void setInt(const std::string &name, int value) const {
-        glUniform1i(glGetUniformLocation(ID, name.c_str()), value);
-    }
-    
-    void setFloat(const std::string &name, float value) const {
-        glUniform1f(glGetUniformLocation(ID, name.c_str()), value);
-    }
-    
-    void setVec3(const std::string &name, float x, float y, float z) const {
-        glUniform3f(glGetUniformLocation(ID, name.c_str()), x, y, z);
-    }
-    
-    void setMat4(const std::string &name, const float* mat) const {
-        glUniformMatrix4fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, mat);
     }
+    return true;
+}
+static_assert(allSceneShaderFeaturesValid(), "Sahne çizimi geçersiz bir shader özellik birleşimi isteyebilir");
+
+// Güncel ayarların temel özellik indeksi
+unsigned int sceneShaderBase(bool shadowsActive, bool pointLightsActive) {
+    if (debugView != 0)
+        return SCENE_LIGHTING_BASES + debugView - 1;
+    return (shadowsActive ? 1u : 0u) | (pointLightsActive ? 2u : 0u);
+}
+
+// Girdi: GLFW callback'leri ana (girdi) iş parçacığında zaman damgalı olay üretir,
+// render iş parçacığı olayları kamerayı hesaplamadan hemen önce tüketir
+InputQueue inputQueue;
+std::atomic<unsigned int> droppedInputEvents(0);
+std::atomic<bool> renderThreadDone(false);
+double refreshPeriodMs = 1000.0 / 60.0; // Gecikme tahmini için ekran yenileme süresi
+
+// Basılı tutulan tuşlar - yalnızca render iş parçacığı okur/yazar
+bool keyHeld[GLFW_KEY_LAST + 1] = {};
+
+// Komut satırı seçenekleri
+struct AppOptions {
+    unsigned int transparentCubes = 256; // --transparent N
+    bool benchmarkTransparency = false;  // --bench-oit
+    unsigned int opaqueCubes = 2000;     // --opaque N
+    unsigned int viewCount = 5;          // --views N (çoklu görünüm modunda, 1-5)
+    bool benchmarkViews = false;         // --bench-views
+    int shadowMapSize = 1024;            // --shadow-size N (kademe başına texel)
+    unsigned int pointLights = 1024;     // --lights N
+    bool benchmarkLights = false;        // --bench-lights
+    unsigned int particleCount = 262144; // --particles N
+    bool benchmarkParticles = false;     // --bench-particles
+    unsigned int texturedCubes = 48;     // --textured N
+    std::string textureDir;              // --textures dizin (.ktx2 / .dds; yoksa prosedürel dokular)
+    unsigned int textureBudgetMB = 8;    // --texture-budget MB
+    float targetFps = 60.0f;             // --target-fps N (dinamik çözünürlük hedefi)
+    float minRenderScale = 0.5f;         // --min-scale S
+    std::string recordPath;              // --record dosya
+    std::string replayPath;              // --replay dosya
 };
 
-// Matris işlemleri için yardımcı fonksiyonlar
-namespace MatrixUtils {
-    // Model matrisini oluşturur - dünya uzayındaki konumu ve yönelimi belirler
-    void createModelMatrix(float* matrix, float angleX, float angleY) {
-        // Birim matris ile başla
-        for (int i = 0; i < 16; i++) {
-            matrix[i] = 0.0f;
-        }
-        matrix[0] = matrix[5] = matrix[10] = matrix[15] = 1.0f;
-        
-        // X ekseni etrafında döndürme
-        float cosX = cos(angleX);
-        float sinX = sin(angleX);
-        
-        // Y ekseni etrafında döndürme
-        float cosY = cos(angleY);
-        float sinY = sin(angleY);
-        
-        // Döndürme matrisini oluştur (X ve Y ekseni etrafında)
-        matrix[0] = cosY;
-        matrix[2] = -sinY;
-        matrix[4] = sinX * sinY;
-        matrix[5] = cosX;
-        matrix[6] = sinX * cosY;
-        matrix[8] = -cosX * sinY;
-        matrix[9] = -sinX;
-        matrix[10] = cosX * cosY;
-    }
-    
-    // Görüntüleme matrisini oluşturur - kamera konumunu ve bakış yönünü belirler
-    void createViewMatrix(float* matrix, float* position, float* target, float* up) {
-        // Bakış yönü vektörünü hesapla (kameradan hedefe doğru)
-        float direction[3];
-        for (int i = 0; i < 3; i++) {
-            direction[i] = target[i] - position[i];
-        }
-        
-        // Vektörü normalize et
-        float length = sqrt(direction[0] * direction[0] + direction[1] * direction[1] + direction[2] * direction[2]);
-        for (int i = 0; i < 3; i++) {
-            direction[i] /= length;
+AppOptions parseOptions(int argc, char** argv) {
+    AppOptions options;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--transparent") == 0 && i + 1 < argc) {
+            options.transparentCubes = static_cast<unsigned int>(std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--bench-oit") == 0) {
+            options.benchmarkTransparency = true;
+        } else if (std::strcmp(argv[i], "--opaque") == 0 && i + 1 < argc) {
+            options.opaqueCubes = static_cast<unsigned int>(std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--views") == 0 && i + 1 < argc) {
+            options.viewCount = static_cast<unsigned int>(std::atoi(argv[++i]));
+            multiViewMode = true;
+        } else if (std::strcmp(argv[i], "--bench-views") == 0) {
+            options.benchmarkViews = true;
+        } else if (std::strcmp(argv[i], "--cascades") == 0 && i + 1 < argc) {
+            shadowCascadeCount = std::min(static_cast<unsigned int>(std::atoi(argv[++i])), MAX_CASCADES);
+        } else if (std::strcmp(argv[i], "--shadow-size") == 0 && i + 1 < argc) {
+            options.shadowMapSize = std::max(64, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--lights") == 0 && i + 1 < argc) {
+            options.pointLights = static_cast<unsigned int>(std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--bench-lights") == 0) {
+            options.benchmarkLights = true;
+        } else if (std::strcmp(argv[i], "--particles") == 0 && i + 1 < argc) {
+            options.particleCount = static_cast<unsigned int>(std::atoi(argv[++i]));
+            particleMode = ParticleMode::Points;
+        } else if (std::strcmp(argv[i], "--bench-particles") == 0) {
+            options.benchmarkParticles = true;
+        } else if (std::strcmp(argv[i], "--textured") == 0 && i + 1 < argc) {
+            options.texturedCubes = static_cast<unsigned int>(std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--textures") == 0 && i + 1 < argc) {
+            options.textureDir = argv[++i];
+        } else if (std::strcmp(argv[i], "--texture-budget") == 0 && i + 1 < argc) {
+            options.textureBudgetMB = static_cast<unsigned int>(std::max(1, std::atoi(argv[++i])));
+        } else if (std::strcmp(argv[i], "--target-fps") == 0 && i + 1 < argc) {
+            options.targetFps = std::max(1.0f, static_cast<float>(std::atof(argv[++i])));
+        } else if (std::strcmp(argv[i], "--min-scale") == 0 && i + 1 < argc) {
+            options.minRenderScale = std::min(1.0f, std::max(0.1f, static_cast<float>(std::atof(argv[++i]))));
+        } else if (std::strcmp(argv[i], "--no-dynamic-res") == 0) {
+            dynamicResolutionEnabled = false;
+        } else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            options.recordPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            options.replayPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--no-prepass") == 0) {
+            depthPrepass = false;
+        } else if (std::strcmp(argv[i], "--cull") == 0 && i + 1 < argc) {
+            const char* mode = argv[++i];
+            cullingMode = std::strcmp(mode, "cpu") == 0 ? CullingMode::CPU :
+                          std::strcmp(mode, "off") == 0 ? CullingMode::Off : CullingMode::GPU;
+        } else {
+            std::cerr << "Bilinmeyen seçenek: " << argv[i] << std::endl;
         }
-        
-        // Sağ vektörünü hesapla (up vektörü ile bakış yönü vektörünün çapraz çarpımı)
-        float right[3];
-        right[0] = up[1] * direction[2] - up[2] * direction[1];
-        right[1] = up[2] * direction[0] - up[0] * direction[2];
-        right[2] = up[0] * direction[1] - up[1] * direction[0];
-        
-        // Right vektörünü normalize et
-        length = sqrt(right[0] * right[0] + right[1] * right[1] + right[2] * right[2]);
-        for (int i = 0; i < 3; i++) {
-            right[i] /= length;
-        }
-        
-        // Yeni yukarı vektörünü hesapla (bakış yönü ve sağ vektörünün çapraz çarpımı)
-        float newUp[3];
-        newUp[0] = direction[1] * right[2] - direction[2] * right[1];
-        newUp[1] = direction[2] * right[0] - direction[0] * right[2];
-        newUp[2] = direction[0] * right[1] - direction[1] * right[0];
-        
-        // Birim matris ile başla
-        for (int i = 0; i < 16; i++) {
-            matrix[i] = 0.0f;
-        }
-        
-        // Görüntüleme matrisi oluştur
-        matrix[0] = right[0];
-        matrix[4] = right[1];
-        matrix[8] = right[2];
-        
-        matrix[1] = newUp[0];
-        matrix[5] = newUp[1];
-        matrix[9] = newUp[2];
-        
-        matrix[2] = -direction[0];
-        matrix[6] = -direction[1];
-        matrix[10] = -direction[2];
-        
-        matrix[15] = 1.0f;
-        
-        // Kamera konumunu matriste ayarla
-        matrix[12] = -(right[0] * position[0] + right[1] * position[1] + right[2] * position[2]);
-        matrix[13] = -(newUp[0] * position[0] + newUp[1] * position[1] + newUp[2] * position[2]);
-        matrix[14] = (direction[0] * position[0] + direction[1] * position[1] + direction[2] * position[2]);
     }
-    
-    // Perspektif projeksiyon matrisini oluşturur - 3D görüntüyü 2D ekrana yansıtır
-    void createPerspectiveMatrix(float* matrix, float fov, float aspect, float near, float far) {
-        // Matris elemanlarını sıfırla
-        for (int i = 0; i < 16; i++) {
-            matrix[i] = 0.0f;
-        }
-        
-        float tanHalfFovy = tan(fov / 2.0f);
-        
-        matrix[0] = 1.0f / (aspect * tanHalfFovy); // X ekseni için skala faktörü
-        matrix[5] = 1.0f / tanHalfFovy;            // Y ekseni için skala faktörü
-        matrix[10] = -(far + near) / (far - near);  // Z değerini normalize etme
-        matrix[11] = -1.0f;                        // W bileşeni için çarpan
-        matrix[14] = -(2.0f * far * near) / (far - near); // Perspektif için öteleme
+    return options;
+}
+
+// Olayı zaman damgasıyla kuyruğa yazar (girdi iş parçacığı); kuyruk doluysa olay düşürülür
+void pushInputEvent(InputEventType type, int key, double x, double y) {
+    InputEvent event = { type, key, x, y, inputClockNs() };
+    if (!inputQueue.push(event)) {
+        droppedInputEvents++;
     }
 }
 
 // Pencere boyutu değiştiğinde çağrılacak fonksiyon
 void framebuffer_size_callback(GLFWwindow* window, int width, int height) {
-    glViewport(0, 0, width, height);
+    pushInputEvent(InputEventType::Resize, 0, width, height);
 }
 
-// Fare hareketini işleyen fonksiyon
+// Fare hareketi olayı
 void mouse_callback(GLFWwindow* window, double xposIn, double yposIn) {
+    pushInputEvent(InputEventType::CursorMove, 0, xposIn, yposIn);
+}
+
+// Fare tekerleği olayı
+void scroll_callback(GLFWwindow* window, double xoffset, double yoffset) {
+    pushInputEvent(InputEventType::Scroll, 0, xoffset, yoffset);
+}
+
+// Klavye olayı - tekrarlar (GLFW_REPEAT) basılı tutma durumuna bir şey eklemez
+void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods) {
+    if (key < 0 || key > GLFW_KEY_LAST || action == GLFW_REPEAT)
+        return;
+    pushInputEvent(action == GLFW_PRESS ? InputEventType::KeyPress : InputEventType::KeyRelease, key, 0.0, 0.0);
+}
+
+// Fare hareketini kamera açılarına uygular
+void applyCursorMove(double xposIn, double yposIn) {
     float xpos = static_cast<float>(xposIn);
     float ypos = static_cast<float>(yposIn);
 
@@ -289,8 +282,8 @@ void mouse_callback(GLFWwindow* window, double xposIn, double yposIn) {
     cameraHeight = sin(pitchRad) * cameraRadius;
 }
 
-// Fare tekerleği girdisini işleyen fonksiyon
-void scroll_callback(GLFWwindow* window, double xoffset, double yoffset) {
+// Fare tekerleği girdisini kamera mesafesine uygular
+void applyScroll(double yoffset) {
     // Kamera mesafesini ayarla (zoom)
     cameraRadius -= static_cast<float>(yoffset) * 0.2f;
     
@@ -301,20 +294,20 @@ void scroll_callback(GLFWwindow* window, double xoffset, double yoffset) {
         cameraRadius = 10.0f;
 }
 
-// Klavye girdilerini işleyen fonksiyon
+// Klavye girdilerini işleyen fonksiyon - basılı tutulan tuşlar her karede uygulanır
 void processInput(GLFWwindow *window) {
     // Escape tuşu - pencereyi kapat
-    if(glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+    if (keyHeld[GLFW_KEY_ESCAPE])
         glfwSetWindowShouldClose(window, true);
     
     // Dönüş hızını ayarlama tuşları
-    if (glfwGetKey(window, GLFW_KEY_UP) == GLFW_PRESS)
+    if (keyHeld[GLFW_KEY_UP])
         rotationSpeedX += 0.01f;
-    if (glfwGetKey(window, GLFW_KEY_DOWN) == GLFW_PRESS)
+    if (keyHeld[GLFW_KEY_DOWN])
         rotationSpeedX -= 0.01f;
-    if (glfwGetKey(window, GLFW_KEY_RIGHT) == GLFW_PRESS)
+    if (keyHeld[GLFW_KEY_RIGHT])
         rotationSpeedY += 0.01f;
-    if (glfwGetKey(window, GLFW_KEY_LEFT) == GLFW_PRESS)
+    if (keyHeld[GLFW_KEY_LEFT])
         rotationSpeedY -= 0.01f;
     
     // Dönüş hızı alt sınırı (negatif olmaması için)
@@ -324,36 +317,108 @@ void processInput(GLFWwindow *window) {
         rotationSpeedY = 0.0f;
         
     // Dönüşü sıfırlama
-    if (glfwGetKey(window, GLFW_KEY_R) == GLFW_PRESS) {
+    if (keyHeld[GLFW_KEY_R]) {
         rotationSpeedX = 0.5f;
         rotationSpeedY = 0.7f;
     }
 }
 
-int main() {
-    // GLFW'yi başlat
-    if (!glfwInit()) {
-        std::cerr << "GLFW başlatılamadı" << std::endl;
-        return -1;
+// Açma/kapama tuşları - yalnızca basılma olayında bir kez uygulanır
+void applyKeyPress(int key) {
+    // Saydamlık yöntemini değiştir
+    if (key == GLFW_KEY_T) {
+        transparencyMode = static_cast<TransparencyMode>((static_cast<int>(transparencyMode) + 1) % 3);
+        std::cout << "Saydamlık: " << transparencyModeName(transparencyMode) << std::endl;
     }
     
-    std::cout << "GLFW başlatıldı" << std::endl;
+    // Derinlik ön geçişini aç/kapat
+    if (key == GLFW_KEY_P) {
+        depthPrepass = !depthPrepass;
+        std::cout << "Derinlik ön geçişi: " << (depthPrepass ? "açık" : "kapalı") << std::endl;
+    }
     
-    // OpenGL versiyonunu 3.3 olarak ayarla
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    // Tek görünüm / çoklu görünüm
+    if (key == GLFW_KEY_V) {
+        multiViewMode = !multiViewMode;
+        std::cout << "Çoklu görünüm: " << (multiViewMode ? "açık" : "kapalı") << std::endl;
+    }
     
-    // Pencere oluştur
-    GLFWwindow* window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "Modern OpenGL 3D Küp", NULL, NULL);
-    if (window == NULL) {
-        std::cerr << "Pencere oluşturulamadı" << std::endl;
-        glfwTerminate();
-        return -1;
+    // Oklüzyon eleme yöntemini değiştir
+    if (key == GLFW_KEY_O) {
+        cullingMode = static_cast<CullingMode>((static_cast<int>(cullingMode) + 1) % 3);
+        std::cout << "Oklüzyon eleme: " << cullingModeName(cullingMode) << std::endl;
+    }
+    
+    // Gölge kademesi sayısını değiştir (kalite / kare süresi dengesi)
+    if (key == GLFW_KEY_K) {
+        shadowCascadeCount = (shadowCascadeCount + 1) % (MAX_CASCADES + 1);
+        std::cout << "Gölge kademesi: " << shadowCascadeCount << std::endl;
+    }
+    
+    // Kümelenmiş nokta ışıklarını aç/kapat
+    if (key == GLFW_KEY_L) {
+        clusteredLighting = !clusteredLighting;
+        std::cout << "Nokta ışıklar: " << (clusteredLighting ? "açık" : "kapalı") << std::endl;
+    }
+    
+    // Parçacık çizim biçimini değiştir
+    if (key == GLFW_KEY_G) {
+        particleMode = static_cast<ParticleMode>((static_cast<int>(particleMode) + 1) % 3);
+        std::cout << "Parçacıklar: " << particleModeName(particleMode) << std::endl;
+    }
+    
+    // Doku kaplanmış küpleri aç/kapat
+    if (key == GLFW_KEY_X) {
+        texturedCubesEnabled = !texturedCubesEnabled;
+        std::cout << "Doku kaplı küpler: " << (texturedCubesEnabled ? "açık" : "kapalı") << std::endl;
+    }
+    
+    // Dinamik çözünürlüğü aç/kapat
+    if (key == GLFW_KEY_D) {
+        dynamicResolutionEnabled = !dynamicResolutionEnabled;
+        std::cout << "Dinamik çözünürlük: " << (dynamicResolutionEnabled ? "açık" : "kapalı") << std::endl;
     }
-    std::cout << "Pencere oluşturuldu" << std::endl;
     
-    // Pencereyi mevcut context olarak ayarla
+    // Hata ayıklama görünümleri arasında geçiş (normaller, konum, ekran koordinatları)
+    if (key == GLFW_KEY_C) {
+        debugView = (debugView + 1) % (SCENE_BASE_COUNT - SCENE_LIGHTING_BASES + 1);
+        std::cout << "Hata ayıklama görünümü: "
+                  << (debugView != 0 ? shaderFeatureName(sceneBaseFeatures(SCENE_LIGHTING_BASES + debugView - 1)) : "kapalı")
+                  << std::endl;
+    }
+}
+
+// Tek bir girdi olayını simülasyon durumuna uygular
+void applyInputEvent(const InputEvent& event) {
+    // Kayıttan okunan tuş kodları da sınır dışına taşmamalı
+    bool keyEvent = event.type == InputEventType::KeyPress || event.type == InputEventType::KeyRelease;
+    if (keyEvent && (event.key < 0 || event.key > GLFW_KEY_LAST))
+        return;
+    
+    switch (event.type) {
+        case InputEventType::KeyPress:
+            keyHeld[event.key] = true;
+            applyKeyPress(event.key);
+            break;
+        case InputEventType::KeyRelease:
+            keyHeld[event.key] = false;
+            break;
+        case InputEventType::CursorMove:
+            applyCursorMove(event.x, event.y);
+            break;
+        case InputEventType::Scroll:
+            applyScroll(event.y);
+            break;
+        case InputEventType::Resize:
+            framebufferWidth = static_cast<int>(event.x);
+            framebufferHeight = static_cast<int>(event.y);
+            break;
+    }
+}
+
+// Render iş parçacığı - GL context'ine sahiptir, simülasyonu ve çizimi yürütür
+int runRenderer(GLFWwindow* window, const AppOptions& options) {
+    // Pencereyi bu iş parçacığında mevcut context olarak ayarla
     glfwMakeContextCurrent(window);
     std::cout << "Context ayarlandı" << std::endl;
     
@@ -367,61 +432,67 @@ int main() {
     // Viewport'u ayarla
     glViewport(0, 0, SCR_WIDTH, SCR_HEIGHT);
     
-    // Pencere boyutu değiştiğinde çağrılacak callback'i ayarla
-    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
-    
-    // Fare kontrollerini ayarla
-    glfwSetCursorPosCallback(window, mouse_callback);
-    glfwSetScrollCallback(window, scroll_callback);
-    
-    // Fare imlecini yakalama (FPS kamera için)
-    glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
-    
     // Derinlik testini etkinleştir
     glEnable(GL_DEPTH_TEST);
     
-    // Shader programını yükle
-    Shader ourShader("/home/mrbasaran/Documents/projects/playground/opengl-claude-code-test/shaders/vertex.glsl", 
-                     "/home/mrbasaran/Documents/projects/playground/opengl-claude-code-test/shaders/fragment.glsl");
+    // Sahne shader'ı permütasyonları - her çizim açık özelliklerin maskesiyle kendi programını seçer;
+    // gölge ve küme örnekleyicileri her yeni programda ayrı doku birimlerine atanır
+    ShaderPermutations sceneShaders;
+    sceneShaders.init(SHADER_DIR + "vertex.glsl", SHADER_DIR + "fragment.glsl", setLightingTextureUnits);
     
-    // Küp için vertex verileri - konum ve renk
+    // Derinlik ön geçişi için yalnızca derinlik yazan programlar (aynı vertex shader)
+    ShaderPermutations depthShaders;
+    depthShaders.init(SHADER_DIR + "vertex.glsl", SHADER_DIR + "depth_fragment.glsl");
+    
+    // Her ayar birleşiminde kullanılan permütasyonlar baştan toplu derlenir; hata ayıklama görünümleri ilk kullanımda
+    std::vector<uint32_t> commonFeatures;
+    for (unsigned int base = 0; base < SCENE_LIGHTING_BASES; base++) {
+        for (SceneDraw draw : { SceneDraw::Single, SceneDraw::Instanced, SceneDraw::Textured })
+            commonFeatures.push_back(sceneShaderFeatures(base, draw));
+    }
+    sceneShaders.precompile(commonFeatures);
+    depthShaders.precompile({ 0u, ShaderFeature::Instancing });
+    std::cout << "Shader permütasyonları: " << sceneShaders.cachedCount() + depthShaders.cachedCount()
+              << " program önceden derlendi (" << sceneShaders.compileMs + depthShaders.compileMs << " ms)" << std::endl;
+    
+    // Küp için vertex verileri - konum, renk, yüz normali ve doku koordinatı
     float vertices[] = {
-        // Koordinatlar (X, Y, Z)     // Renkler (R, G, B)
+        // Koordinatlar (X, Y, Z)     // Renkler (R, G, B)   // Normaller (X, Y, Z)   // Doku (U, V)
         // Ön yüz (kırmızı)
-        -0.5f, -0.5f,  0.5f,  1.0f, 0.0f, 0.0f,
-         0.5f, -0.5f,  0.5f,  1.0f, 0.0f, 0.0f,
-         0.5f,  0.5f,  0.5f,  1.0f, 0.0f, 0.0f,
-        -0.5f,  0.5f,  0.5f,  1.0f, 0.0f, 0.0f,
+        -0.5f, -0.5f,  0.5f,  1.0f, 0.0f, 0.0f,   0.0f,  0.0f,  1.0f,   0.0f, 0.0f,
+         0.5f, -0.5f,  0.5f,  1.0f, 0.0f, 0.0f,   0.0f,  0.0f,  1.0f,   1.0f, 0.0f,
+         0.5f,  0.5f,  0.5f,  1.0f, 0.0f, 0.0f,   0.0f,  0.0f,  1.0f,   1.0f, 1.0f,
+        -0.5f,  0.5f,  0.5f,  1.0f, 0.0f, 0.0f,   0.0f,  0.0f,  1.0f,   0.0f, 1.0f,
         
         // Arka yüz (yeşil)
-        -0.5f, -0.5f, -0.5f,  0.0f, 1.0f, 0.0f,
-         0.5f, -0.5f, -0.5f,  0.0f, 1.0f, 0.0f,
-         0.5f,  0.5f, -0.5f,  0.0f, 1.0f, 0.0f,
-        -0.5f,  0.5f, -0.5f,  0.0f, 1.0f, 0.0f,
+        -0.5f, -0.5f, -0.5f,  0.0f, 1.0f, 0.0f,   0.0f,  0.0f, -1.0f,   0.0f, 0.0f,
+         0.5f, -0.5f, -0.5f,  0.0f, 1.0f, 0.0f,   0.0f,  0.0f, -1.0f,   1.0f, 0.0f,
+         0.5f,  0.5f, -0.5f,  0.0f, 1.0f, 0.0f,   0.0f,  0.0f, -1.0f,   1.0f, 1.0f,
+        -0.5f,  0.5f, -0.5f,  0.0f, 1.0f, 0.0f,   0.0f,  0.0f, -1.0f,   0.0f, 1.0f,
         
         // Üst yüz (mavi)
-        -0.5f,  0.5f,  0.5f,  0.0f, 0.0f, 1.0f,
-         0.5f,  0.5f,  0.5f,  0.0f, 0.0f, 1.0f,
-         0.5f,  0.5f, -0.5f,  0.0f, 0.0f, 1.0f,
-        -0.5f,  0.5f, -0.5f,  0.0f, 0.0f, 1.0f,
+        -0.5f,  0.5f,  0.5f,  0.0f, 0.0f, 1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 0.0f,
+         0.5f,  0.5f,  0.5f,  0.0f, 0.0f, 1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 0.0f,
+         0.5f,  0.5f, -0.5f,  0.0f, 0.0f, 1.0f,   0.0f,  1.0f,  0.0f,   1.0f, 1.0f,
+        -0.5f,  0.5f, -0.5f,  0.0f, 0.0f, 1.0f,   0.0f,  1.0f,  0.0f,   0.0f, 1.0f,
         
         // Alt yüz (sarı)
-        -0.5f, -0.5f,  0.5f,  1.0f, 1.0f, 0.0f,
-         0.5f, -0.5f,  0.5f,  1.0f, 1.0f, 0.0f,
-         0.5f, -0.5f, -0.5f,  1.0f, 1.0f, 0.0f,
-        -0.5f, -0.5f, -0.5f,  1.0f, 1.0f, 0.0f,
+        -0.5f, -0.5f,  0.5f,  1.0f, 1.0f, 0.0f,   0.0f, -1.0f,  0.0f,   0.0f, 0.0f,
+         0.5f, -0.5f,  0.5f,  1.0f, 1.0f, 0.0f,   0.0f, -1.0f,  0.0f,   1.0f, 0.0f,
+         0.5f, -0.5f, -0.5f,  1.0f, 1.0f, 0.0f,   0.0f, -1.0f,  0.0f,   1.0f, 1.0f,
+        -0.5f, -0.5f, -0.5f,  1.0f, 1.0f, 0.0f,   0.0f, -1.0f,  0.0f,   0.0f, 1.0f,
         
         // Sağ yüz (turkuaz)
-         0.5f, -0.5f,  0.5f,  0.0f, 1.0f, 1.0f,
-         0.5f,  0.5f,  0.5f,  0.0f, 1.0f, 1.0f,
-         0.5f,  0.5f, -0.5f,  0.0f, 1.0f, 1.0f,
-         0.5f, -0.5f, -0.5f,  0.0f, 1.0f, 1.0f,
+         0.5f, -0.5f,  0.5f,  0.0f, 1.0f, 1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 0.0f,
+         0.5f,  0.5f,  0.5f,  0.0f, 1.0f, 1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
+         0.5f,  0.5f, -0.5f,  0.0f, 1.0f, 1.0f,   1.0f,  0.0f,  0.0f,   1.0f, 1.0f,
+         0.5f, -0.5f, -0.5f,  0.0f, 1.0f, 1.0f,   1.0f,  0.0f,  0.0f,   0.0f, 1.0f,
         
         // Sol yüz (mor)
-        -0.5f, -0.5f,  0.5f,  1.0f, 0.0f, 1.0f,
-        -0.5f,  0.5f,  0.5f,  1.0f, 0.0f, 1.0f,
-        -0.5f,  0.5f, -0.5f,  1.0f, 0.0f, 1.0f,
-        -0.5f, -0.5f, -0.5f,  1.0f, 0.0f, 1.0f
+        -0.5f, -0.5f,  0.5f,  1.0f, 0.0f, 1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 0.0f,
+        -0.5f,  0.5f,  0.5f,  1.0f, 0.0f, 1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 0.0f,
+        -0.5f,  0.5f, -0.5f,  1.0f, 0.0f, 1.0f,  -1.0f,  0.0f,  0.0f,   1.0f, 1.0f,
+        -0.5f, -0.5f, -0.5f,  1.0f, 0.0f, 1.0f,  -1.0f,  0.0f,  0.0f,   0.0f, 1.0f
     };
     
     // Yüzleri oluşturmak için indeksler
@@ -457,18 +528,109 @@ int main() {
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
     
-    // Vertex pozisyon özniteliğini ayarla
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
+    // Vertex pozisyon, renk, normal ve doku koordinatı özniteliklerini ayarla
+    setCubeVertexAttributes();
     
-    // Vertex renk özniteliğini ayarla
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
+    // Örnek öznitelikleri bu VAO'da kapalı - tekil küp sabit değerlerle çizilir
+    setDefaultInstanceAttributes();
     
     // VAO ve VBO bağlantısını kaldır (artık tanımlı ve kullanıma hazır)
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
     
+    // Sahne ekran dışı hedefe çizilir; saydamlık geçişi onun derinliğini paylaşır
+    RenderTarget sceneTarget;
+    sceneTarget.create(framebufferWidth, framebufferHeight);
+    
+    // Merkezdeki küpün etrafındaki yarı saydam küpler
+    TransparencyRenderer transparency;
+    transparency.init(SHADER_DIR, VBO, EBO);
+    transparency.resize(sceneTarget);
+    transparency.setInstances(generateTransparentCubes(options.transparentCubes, 2.5f, 42u));
+    
+    // Opak küp alanı ve Hi-Z oklüzyon eleme
+    std::vector<CubeInstance> opaqueCubes = generateOpaqueCubes(options.opaqueCubes, 15.0f, 7u);
+    OcclusionCuller occlusion;
+    occlusion.init(SHADER_DIR, VBO, EBO);
+    occlusion.setInstances(opaqueCubes);
+    
+    // Çoklu görünüm - aynı opak küp alanını paylaşır
+    MultiViewRenderer multiView;
+    multiView.init(SHADER_DIR, VAO, VBO, EBO);
+    multiView.setInstances(opaqueCubes);
+    std::vector<View> views;
+    unsigned int viewCount = std::max(1u, std::min(options.viewCount, 5u));
+    
+    // Yönlü ışığın kademeli gölge haritaları - gölge düşüren küpler çoklu görünüm çiziciyle elenir
+    CascadedShadowMap shadows;
+    shadows.init(shadowCascadeCount, options.shadowMapSize);
+    
+    // Opak küp alanına dağılmış nokta ışıklar - her karede kümelere atanır
+    ClusteredLights clusteredLights;
+    clusteredLights.init();
+    clusteredLights.setLights(generatePointLights(options.pointLights, 15.0f, 11u));
+    
+    // Merkezdeki küpün üstünden fışkıran GPU parçacıkları
+    ParticleSystem particles;
+    particles.init(SHADER_DIR, VBO, EBO);
+    particles.reset(options.particleCount, 5u);
+    
+    // Doku kaplanmış küpler - dokular arka planda yüklenir, mip seviyeleri ekran boyutuna göre GPU'ya alınır
+    TextureStreamer textureStreamer;
+    textureStreamer.budgetBytes = (size_t)options.textureBudgetMB << 20;
+    
+    // Girdi tekrarında yüklemeler eşzamanlı - dokular her çalıştırmada aynı karede yerleşir
+    textureStreamer.synchronous = !options.replayPath.empty();
+    textureStreamer.init(2);
+    std::vector<unsigned int> textures;
+    if (!options.textureDir.empty())
+        textures = textureStreamer.addDirectory(options.textureDir);
+    if (textures.empty()) {
+        for (unsigned int i = 0; i < 16; i++)
+            textures.push_back(textureStreamer.addProcedural(i, 1024));
+    }
+    TexturedCubes texturedCubes;
+    texturedCubes.init(VBO, EBO);
+    texturedCubes.setInstances(generateTexturedCubes(options.texturedCubes, 3.5f, 8.0f, 13u), textures);
+    
+    // Dinamik çözünürlük - bütçenin bir kısmı CPU tarafı ve sunum için ayrılır
+    DynamicResolution dynamicResolution;
+    dynamicResolution.targetMs = 1000.0f / options.targetFps * 0.9f;
+    dynamicResolution.minScale = options.minRenderScale;
+    dynamicResolution.enabled = dynamicResolutionEnabled;
+    dynamicResolution.init();
+    
+    // Overdraw ölçümü - sorgular çift tamponlu, sonuç bir kare sonra beklemeden okunur
+    unsigned int overdrawQueries[2];
+    glGenQueries(2, overdrawQueries);
+    
+    // GL nesnelerini bırakır - erken dönüşler ve normal çıkış aynı yolu kullanır,
+    // yeni bir modül yalnızca buraya eklenir
+    auto destroyResources = [&]() {
+        glDeleteQueries(2, overdrawQueries);
+        dynamicResolution.destroy();
+        texturedCubes.destroy();
+        textureStreamer.destroy();
+        particles.destroy();
+        clusteredLights.destroy();
+        shadows.destroy();
+        multiView.destroy();
+        occlusion.destroy();
+        transparency.destroy();
+        sceneTarget.destroy();
+        depthShaders.destroy();
+        sceneShaders.destroy();
+        glDeleteVertexArrays(1, &VAO);
+        glDeleteBuffers(1, &VBO);
+        glDeleteBuffers(1, &EBO);
+    };
+    unsigned long long frameIndex = 0;
+    double statsStartTime = glfwGetTime();
+    double overdrawSum = 0.0;
+    unsigned long long culledSum = 0;
+    unsigned int statsFrames = 0;
+    bool statsMultiView = multiViewMode; // İstatistiklerin toplandığı görünüm modu
+    
     // Matrisleri oluştur
     float modelMatrix[16], viewMatrix[16], projectionMatrix[16];
     
@@ -479,10 +641,13 @@ int main() {
     
     // Projeksiyon parametreleri
     float fov = 45.0f * 3.14159f / 180.0f; // FOV 45 derece (radyan cinsinden)
-    float aspectRatio = (float)SCR_WIDTH / (float)SCR_HEIGHT;
+    float aspectRatio = (float)framebufferWidth / (float)framebufferHeight;
     float nearPlane = 0.1f;
     float farPlane = 100.0f;
     
+    // Birim model matrisi (örneklenmiş küpler dünya uzayında tanımlı)
+    const float identityMatrix[16] = { 1, 0, 0, 0,  0, 1, 0, 0,  0, 0, 1, 0,  0, 0, 0, 1 };
+    
     // Animasyon değişkenleri
     float angleX = 0.0f;
     float angleY = 0.0f;
@@ -490,24 +655,130 @@ int main() {
     // Projeksiyon matrisini oluştur
     MatrixUtils::createPerspectiveMatrix(projectionMatrix, fov, aspectRatio, nearPlane, farPlane);
     
+    // Parçacık simülasyonu ölçümü - GPU, skaler ve SSE CPU adımı ile doğrulama
+    if (options.benchmarkParticles) {
+        runParticleBenchmark(particles);
+        destroyResources();
+        return 0;
+    }
+    
+    // Kümelenmiş ışık ataması ölçümü - skaler ve SSE yolu, sabit kamera
+    if (options.benchmarkLights) {
+        MatrixUtils::createViewMatrix(viewMatrix, cameraPos, cameraTarget, cameraUp);
+        runClusteredLightsBenchmark(clusteredLights, viewMatrix, projectionMatrix, nearPlane, farPlane,
+                                    sceneTarget.width, sceneTarget.height);
+        destroyResources();
+        return 0;
+    }
+    
+    // Çoklu görünüm maliyet ölçümü - 1'den 5'e kadar görünüm, sabit kamera
+    if (options.benchmarkViews) {
+        glfwSwapInterval(0);
+        MatrixUtils::createViewMatrix(viewMatrix, cameraPos, cameraTarget, cameraUp);
+        MatrixUtils::createModelMatrix(modelMatrix, 0.0f, 0.0f);
+        runMultiViewBenchmark(multiView, sceneTarget, viewMatrix, modelMatrix, fov, nearPlane, farPlane);
+        destroyResources();
+        return 0;
+    }
+    
+    // Karşılaştırma modu - sabit kamerayla çalışır, sonuçları yazdırır ve çıkar
+    if (options.benchmarkTransparency) {
+        glfwSwapInterval(0);
+        MatrixUtils::createViewMatrix(viewMatrix, cameraPos, cameraTarget, cameraUp);
+        runTransparencyBenchmark(transparency, sceneTarget, sceneShaders.get<ShaderFeature::Instancing | ShaderFeature::Lighting>(),
+                                 viewMatrix, projectionMatrix);
+        destroyResources();
+        return 0;
+    }
+    
+    // Girdi kaydı ve tekrarı - tekrar sabit zaman adımıyla çalışır, böylece her çalıştırma aynı kareleri üretir
+    InputRecorder recorder;
+    InputReplay replay;
+    bool replaying = false;
+    if (!options.recordPath.empty())
+        recorder.open(options.recordPath);
+    if (!options.replayPath.empty()) {
+        if (!replay.load(options.replayPath)) {
+            destroyResources();
+            return -1;
+        }
+        replaying = true;
+        glfwSwapInterval(0);
+        statsStartTime = 0.0;
+        std::cout << "Girdi tekrarı: " << replay.eventCount() << " olay" << std::endl;
+    }
+    LatencyTracker latency;
+    std::vector<InputEvent> frameEvents;
+    std::vector<float> frameTimes;
+    uint64_t frameNumber = 0;
+    float previousTimeValue = 0.0f;
+    
     // Render döngüsü
     std::cout << "Render döngüsü başlıyor" << std::endl;
     while (!glfwWindowShouldClose(window)) {
+        uint64_t frameStart = inputClockNs();
+        
+        // Bir önceki karenin GPU'da bitmesini bekle - gecikmeyi ölçer ve sürücünün önden
+        // kare biriktirmesini engeller; girdi bu beklemeden sonra, olabildiğince geç okunur
+        latency.waitPreviousFrame(refreshPeriodMs);
+        
+        // Girdi olaylarını tüket - tekrarda canlı girdiden yalnızca pencere boyutu ve ESC alınır
+        frameEvents.clear();
+        InputEvent liveEvent;
+        while (inputQueue.pop(liveEvent)) {
+            bool passThrough = liveEvent.type == InputEventType::Resize ||
+                               (liveEvent.type == InputEventType::KeyPress && liveEvent.key == GLFW_KEY_ESCAPE);
+            if (!replaying || passThrough)
+                frameEvents.push_back(liveEvent);
+        }
+        if (replaying) {
+            if (replay.finished(frameNumber))
+                break;
+            
+            // Kayıttaki pencere boyutları uygulanmaz - hedef gerçek pencereyle eşleşmeli
+            size_t firstReplayed = frameEvents.size();
+            replay.eventsForFrame(frameNumber, frameEvents);
+            frameEvents.erase(std::remove_if(frameEvents.begin() + firstReplayed, frameEvents.end(),
+                                             [](const InputEvent& event) { return event.type == InputEventType::Resize; }),
+                              frameEvents.end());
+        }
+        for (const InputEvent& event : frameEvents) {
+            applyInputEvent(event);
+            latency.eventConsumed(event.timestamp);
+            if (recorder.isOpen())
+                recorder.write(frameNumber, event);
+        }
+        
         // Girdi işleme
         processInput(window);
         
-        // Render
-        glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        // Sahne çözünürlüğü - dinamik çözünürlük açıksa pencere boyutunun ölçeklenmiş hali
+        // Tekrarda ölçek tam çözünürlüğe sabitlenir; kare işi ölçülen GPU süresine bağlı değişmemeli
+        dynamicResolution.enabled = dynamicResolutionEnabled && !replaying;
+        int renderWidth, renderHeight;
+        dynamicResolution.renderSize(framebufferWidth, framebufferHeight, renderWidth, renderHeight);
+        
+        // Pencere ya da çizim boyutu değiştiyse hedefleri ve projeksiyonu güncelle
+        // En-boy oranı pencereden alınır - yuvarlanmış çizim boyutu oranı bozmasın
+        if (framebufferWidth > 0 && framebufferHeight > 0 &&
+            sceneTarget.resize(renderWidth, renderHeight)) {
+            transparency.resize(sceneTarget);
+            aspectRatio = (float)framebufferWidth / (float)framebufferHeight;
+            MatrixUtils::createPerspectiveMatrix(projectionMatrix, fov, aspectRatio, nearPlane, farPlane);
+        }
         
-        // Shader programını aktif et
-        ourShader.use();
+        // Bu karenin GPU süresi - yalnızca GPU geçişlerini çevreleyen bölümler toplanır, aradaki CPU işi sayılmaz
+        dynamicResolution.beginFrame();
         
-        // Zamanla değişen dönüş açılarını hesapla
-        float timeValue = glfwGetTime();
+        // Zamanla değişen dönüş açılarını hesapla (tekrarda sabit 60 Hz adım)
+        float timeValue = replaying ? (float)(frameNumber / 60.0) : (float)glfwGetTime();
         angleX = timeValue * rotationSpeedX;
         angleY = timeValue * rotationSpeedY;
         
+        // Simülasyon adımı - takılmalarda parçacıklar sıçramasın diye sınırlanır
+        float deltaTime = std::min(timeValue - previousTimeValue, 1.0f / 30.0f);
+        previousTimeValue = timeValue;
+        
         // Kamera pozisyonunu güncelle
         cameraPos[0] = cos(cameraAngle) * cameraRadius;
         cameraPos[1] = cameraHeight;
@@ -519,30 +790,347 @@ int main() {
         // Model matrisini güncelle (dönüş animasyonu için)
         MatrixUtils::createModelMatrix(modelMatrix, angleX, angleY);
         
-        // Matrisleri shader'a gönder
-        ourShader.setMat4("model", modelMatrix);
-        ourShader.setMat4("view", viewMatrix);
-        ourShader.setMat4("projection", projectionMatrix);
+        // Hi-Z eleme testleri için görünüm-projeksiyon matrisi
+        float viewProjectionMatrix[16];
+        MatrixUtils::multiply(viewProjectionMatrix, projectionMatrix, viewMatrix);
         
         // Ortam ışığı şiddetini güncelle (isteğe bağlı - animasyon için)
         float ambientValue = (sin(timeValue) * 0.2f) + 0.3f; // 0.1 - 0.5 arasında değişen ambient değeri
-        ourShader.setFloat("ambientStrength", ambientValue);
         
-        // Küpü çiz
-        glBindVertexArray(VAO);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+        // Parçacıklar tamamen GPU'da ilerler - CPU'ya veri dönmez
+        if (particleMode != ParticleMode::Off) {
+            dynamicResolution.beginSection();
+            particles.update(deltaTime);
+            dynamicResolution.endSection();
+        }
+        
+        // Görünüm modu değiştiyse istatistikler sıfırdan başlar - önceki modun toplamları ortalamaya karışmaz
+        // (overdraw sorgusu çoklu görünümde kullanılmıyor, tek görünüme dönüşte ilk sorgudan yeniden başlanır)
+        if (multiViewMode != statsMultiView) {
+            statsMultiView = multiViewMode;
+            frameIndex = 0;
+            statsFrames = 0;
+            overdrawSum = 0.0;
+            culledSum = 0;
+            statsStartTime = timeValue;
+        }
         
-        // Tamponları değiştir ve olayları sorgula
+        if (multiViewMode) {
+            // Çoklu görünüm: tek eleme geçişi ve tek komut akışı ile tüm kameralar
+            buildViews(views, viewCount, viewMatrix, sceneTarget.width, sceneTarget.height, fov, nearPlane, farPlane,
+                       sceneTarget.FBO, multiView.auxiliaryFramebuffer(), multiView.auxiliarySize());
+            glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+            multiView.cullAndRecord(views);
+            dynamicResolution.beginSection();
+            multiView.execute(views, modelMatrix, ambientValue);
+            sceneTarget.bind();
+        } else {
+            // Gölge kademeleri - yalnızca derinlik, sahneden önce
+            if (shadows.cascadeCount() != shadowCascadeCount)
+                shadows.setCascadeCount(shadowCascadeCount);
+            shadows.update(viewMatrix, fov, aspectRatio, nearPlane);
+            shadows.cull(multiView);
+            dynamicResolution.beginSection();
+            shadows.render(multiView, modelMatrix);
+            dynamicResolution.endSection();
+            
+            // Nokta ışıkları bu karenin kamerasının kümelerine ata
+            if (clusteredLighting) {
+                clusteredLights.animate(timeValue);
+                clusteredLights.build(viewMatrix, projectionMatrix, nearPlane, farPlane, sceneTarget.width, sceneTarget.height);
+            }
+            
+            // Görünen doku küplerinin mip seviyelerini iste; yüklemeler ve tahliyeler bütçe içinde yapılır
+            if (texturedCubesEnabled)
+                texturedCubes.requestMips(textureStreamer, viewProjectionMatrix, cameraPos, fov, sceneTarget.height);
+            textureStreamer.update();
+            
+            // Saydam küplerin CPU sıralaması - çizimden önce, GPU ölçümünün dışında
+            transparency.prepare(transparencyMode, viewMatrix);
+            
+            // Eleme sonucu ön geçişten önce hazır olmalı: CPU elemesi bir önceki karenin kaba derinliğini kullanır,
+            // GPU elemesinin bir önceki karede yazdığı görünür küme beklemeden alınır
+            if (cullingMode == CullingMode::CPU)
+                occlusion.cullCPU();
+            else if (cullingMode == CullingMode::GPU)
+                occlusion.resolveGPU();
+            
+            // Render - sahne geçişleri ve blit tek ölçüm bölümü
+            dynamicResolution.beginSection();
+            sceneTarget.bind();
+            glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            
+            // Derinlik ön geçişi - renk yazılmaz, gölgeleme geçişi yalnızca en yakın yüzeyleri işler
+            bool hiZBuilt = false;
+            if (depthPrepass) {
+                glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+                Shader& cubeDepthShader = depthShaders.get<0>();
+                cubeDepthShader.use();
+                cubeDepthShader.setMat4("model", modelMatrix);
+                cubeDepthShader.setMat4("view", viewMatrix);
+                cubeDepthShader.setMat4("projection", projectionMatrix);
+                glBindVertexArray(VAO);
+                glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+                
+                Shader& fieldDepthShader = depthShaders.get<ShaderFeature::Instancing>();
+                fieldDepthShader.use();
+                fieldDepthShader.setMat4("model", identityMatrix);
+                fieldDepthShader.setMat4("view", viewMatrix);
+                fieldDepthShader.setMat4("projection", projectionMatrix);
+                if (cullingMode == CullingMode::Off)
+                    occlusion.drawAll();
+                else
+                    occlusion.drawVisible();
+                glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+                
+                // GPU elemesi bu karenin derinliğini kullanabilir
+                if (cullingMode == CullingMode::GPU) {
+                    occlusion.buildHiZ(sceneTarget, viewProjectionMatrix, false);
+                    sceneTarget.bind();
+                    hiZBuilt = true;
+                }
+            }
+            
+            // GPU elemesi - sonucu bir sonraki karede çizilir; ön geçiş kapalıysa bir önceki karenin Hi-Z piramidiyle
+            if (cullingMode == CullingMode::GPU)
+                occlusion.cullGPU();
+            
+            // Gölgeleme geçişi - ön geçişten sonra derinlik yazılmaz, eşit derinlikler geçer
+            if (depthPrepass) {
+                glDepthFunc(GL_LEQUAL);
+                glDepthMask(GL_FALSE);
+            }
+            glBeginQuery(GL_SAMPLES_PASSED, overdrawQueries[frameIndex % 2]);
+            
+            // Sahne shader'ının özellikleri - kapalı olanlar programa hiç derlenmez;
+            // hata ayıklama görünümleri aydınlatmasız permütasyonlardır
+            unsigned int sceneBase = sceneShaderBase(shadows.cascadeCount() > 0,
+                                                     clusteredLighting && clusteredLights.lightCount() > 0);
+            
+            // Permütasyonu aktif et ve ortak uniform'larını gönder
+            auto useSceneShader = [&](SceneDraw draw, const float* model) -> Shader& {
+                uint32_t features = sceneShaderFeatures(sceneBase, draw);
+                Shader& shader = sceneShaders.get(features);
+                shader.use();
+                shader.setMat4("model", model);
+                shader.setMat4("view", viewMatrix);
+                shader.setMat4("projection", projectionMatrix);
+                shader.setFloat("ambientStrength", ambientValue);
+                shader.setVec3("viewPosition", cameraPos[0], cameraPos[1], cameraPos[2]);
+                shader.setVec2("viewportSize", (float)sceneTarget.width, (float)sceneTarget.height);
+                if (features & ShaderFeature::Shadows)
+                    shadows.apply(shader);
+                if (features & ShaderFeature::ClusteredLights)
+                    clusteredLights.apply(shader);
+                return shader;
+            };
+            
+            // Küpü çiz - tekil küp örnekleme öznitelikleri olmadan
+            useSceneShader(SceneDraw::Single, modelMatrix);
+            glBindVertexArray(VAO);
+            glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+            
+            // Opak küp alanı
+            Shader& instancedShader = useSceneShader(SceneDraw::Instanced, identityMatrix);
+            if (cullingMode == CullingMode::Off)
+                occlusion.drawAll();
+            else
+                occlusion.drawVisible();
+            
+            glEndQuery(GL_SAMPLES_PASSED);
+            glDepthFunc(GL_LESS);
+            glDepthMask(GL_TRUE);
+            
+            // Doku kaplanmış küpler - ön geçişte yoklar, derinlik yazarak çizilir;
+            // dokusu yerleşik gruplar doku permütasyonuyla, henüz gelmeyenler vertex rengiyle
+            if (texturedCubesEnabled) {
+                useSceneShader(SceneDraw::Textured, identityMatrix);
+                texturedCubes.draw(textureStreamer, true);
+                instancedShader.use();
+                texturedCubes.draw(textureStreamer, false);
+            }
+            
+            // Parçacıklar - ön geçişte yoklar, derinlik yazarak çizilir
+            if (particleMode == ParticleMode::Cubes) {
+                instancedShader.use();
+                particles.drawCubes();
+            } else if (particleMode == ParticleMode::Points) {
+                particles.drawPoints(viewMatrix, projectionMatrix);
+            }
+            
+            // Hi-Z bu karede oluşturulmadıysa bir sonraki kare için şimdi oluştur
+            if (cullingMode != CullingMode::Off && !hiZBuilt) {
+                occlusion.buildHiZ(sceneTarget, viewProjectionMatrix, cullingMode == CullingMode::CPU);
+                sceneTarget.bind();
+            }
+            
+            // Yarı saydam küpler - opak geometriden sonra
+            transparency.render(transparencyMode, sceneTarget, instancedShader, viewMatrix, projectionMatrix, ambientValue);
+            
+        }
+        
+        // Sahneyi pencereye kopyala (düşük çözünürlükteyse büyüterek)
+        sceneTarget.blitToDefault(framebufferWidth, framebufferHeight);
+        dynamicResolution.endSection();
+        dynamicResolution.endFrame();
+        
+        // Bir önceki karenin overdraw sorgusunu oku (bu noktada tamamlanmış olmalı)
+        if (!multiViewMode && frameIndex > 0) {
+            GLuint samplesPassed = 0;
+            glGetQueryObjectuiv(overdrawQueries[(frameIndex + 1) % 2], GL_QUERY_RESULT, &samplesPassed);
+            overdrawSum += (double)samplesPassed / ((double)sceneTarget.width * sceneTarget.height);
+            culledSum += occlusion.instanceCount() - (cullingMode == CullingMode::Off ? occlusion.instanceCount() : occlusion.visibleCount);
+            statsFrames++;
+        }
+        if (!multiViewMode)
+            frameIndex++;
+        
+        // İstatistikleri iki saniyede bir yazdır
+        if (timeValue - statsStartTime >= 2.0 && latency.sampleCount() > 0) {
+            std::cout << "Gecikme (giriş → ekran, tahmini): ort. " << latency.averageMs() << " ms, en kötü "
+                      << latency.worstMs() << " ms (" << latency.sampleCount() << " olay)" << std::endl;
+            // Tekrarda sıfırlanmaz - özet tüm çalıştırmanın gecikmesini raporlar
+            if (!replaying)
+                latency.reset();
+        }
+        if (multiViewMode && timeValue - statsStartTime >= 2.0) {
+            std::cout << "Görünüm: " << views.size() << " | eleme + kayıt: " << multiView.lastCullMs << " ms | görünür:";
+            for (unsigned int count : multiView.visiblePerView)
+                std::cout << " " << count;
+            std::cout << std::endl;
+            statsStartTime = timeValue;
+        }
+        if (timeValue - statsStartTime >= 2.0 && statsFrames > 0) {
+            std::cout << "Overdraw: " << overdrawSum / statsFrames
+                      << " | Elenen opak küp: " << culledSum / statsFrames << "/" << occlusion.instanceCount()
+                      << " (" << cullingModeName(cullingMode) << ", ön geçiş " << (depthPrepass ? "açık" : "kapalı") << ")";
+            if (cullingMode == CullingMode::GPU) {
+                std::cout << " | Eleme sonucu beklemesi: " << occlusion.feedbackStalls << " kare, "
+                          << occlusion.feedbackStallMs << " ms";
+            }
+            if (shadows.cascadeCount() > 0) {
+                std::cout << " | Gölge kademesi: " << shadows.cascadeCount() << ", dökücü:";
+                for (unsigned int count : shadows.castersPerCascade)
+                    std::cout << " " << count;
+                std::cout << " (" << shadows.lastCullMs << " ms)";
+            }
+            if (clusteredLighting && clusteredLights.lightCount() > 0) {
+                std::cout << " | Işık: " << clusteredLights.lightCount() << ", atama: " << clusteredLights.lastBinMs
+                          << " ms, ort. ışık/küme: "
+                          << (clusteredLights.lastActiveClusters > 0 ? clusteredLights.lastIndexCount / clusteredLights.lastActiveClusters : 0)
+                          << ", en fazla: " << clusteredLights.lastMaxPerCluster;
+            }
+            if (particleMode != ParticleMode::Off) {
+                std::cout << " | Parçacık: " << particles.particleCount() << " (" << particleModeName(particleMode)
+                          << "), GPU adımı: " << particles.lastUpdateMs << " ms";
+            }
+            if (dynamicResolution.enabled) {
+                std::cout << " | Çözünürlük: " << sceneTarget.width << "x" << sceneTarget.height << " (%"
+                          << (int)(dynamicResolution.scale * 100.0f + 0.5f) << "), GPU: " << dynamicResolution.lastGpuMs
+                          << "/" << dynamicResolution.targetMs << " ms";
+            }
+            if (texturedCubesEnabled && textureStreamer.frames > 0) {
+                double uploadedMB = textureStreamer.uploadedBytes / (1024.0 * 1024.0);
+                std::cout << " | Doku: " << textureStreamer.residentBytes / (1024.0 * 1024.0) << "/"
+                          << textureStreamer.budgetBytes / (1024.0 * 1024.0) << " MB yerleşik, yükleme: "
+                          << uploadedMB / textureStreamer.frames << " MB/kare ("
+                          << uploadedMB / (timeValue - statsStartTime) << " MB/s, "
+                          << textureStreamer.uploadMs / textureStreamer.frames << " ms), tahliye: " << textureStreamer.evictions;
+                if (textureStreamer.pendingLoads() > 0)
+                    std::cout << ", yüklenen: " << textureStreamer.pendingLoads();
+            }
+            std::cout << std::endl;
+            statsStartTime = timeValue;
+            overdrawSum = 0.0;
+            culledSum = 0;
+            statsFrames = 0;
+            occlusion.resetStats();
+            textureStreamer.resetStats();
+        }
+        
+        // Tamponları değiştir - olaylar ana iş parçacığında işlenir
         glfwSwapBuffers(window);
-        glfwPollEvents();
+        latency.frameSubmitted();
+        
+        if (replaying)
+            frameTimes.push_back((float)((inputClockNs() - frameStart) / 1e6));
+        frameNumber++;
     }
     
+    // Tekrar sonunda kare süresi özeti
+    if (replaying)
+        printReplaySummary(frameTimes, latency);
+    recorder.close();
+    latency.destroy();
+    
     // OpenGL nesnelerini temizle
-    glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &VBO);
-    glDeleteBuffers(1, &EBO);
+    destroyResources();
+    
+    // Context'i bırak - pencere ana iş parçacığında yok edilir
+    glfwMakeContextCurrent(NULL);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    AppOptions options = parseOptions(argc, argv);
+    
+    // GLFW'yi başlat
+    if (!glfwInit()) {
+        std::cerr << "GLFW başlatılamadı" << std::endl;
+        return -1;
+    }
+    
+    std::cout << "GLFW başlatıldı" << std::endl;
+    
+    // OpenGL versiyonunu 3.3 olarak ayarla
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    
+    // Pencere oluştur
+    GLFWwindow* window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "Modern OpenGL 3D Küp", NULL, NULL);
+    if (window == NULL) {
+        std::cerr << "Pencere oluşturulamadı" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+    std::cout << "Pencere oluşturuldu" << std::endl;
+    
+    // Pencere boyutu değiştiğinde çağrılacak callback'i ayarla
+    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+    
+    // Fare ve klavye kontrollerini ayarla - callback'ler yalnızca olay kuyruğuna yazar
+    glfwSetCursorPosCallback(window, mouse_callback);
+    glfwSetScrollCallback(window, scroll_callback);
+    glfwSetKeyCallback(window, key_callback);
+    
+    // Fare imlecini yakalama (FPS kamera için)
+    glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+    
+    // Pencere ve monitör sorguları yalnızca bu (ana) iş parçacığında yapılabilir
+    glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+    GLFWmonitor* monitor = glfwGetPrimaryMonitor();
+    const GLFWvidmode* videoMode = monitor != NULL ? glfwGetVideoMode(monitor) : NULL;
+    if (videoMode != NULL && videoMode->refreshRate > 0)
+        refreshPeriodMs = 1000.0 / videoMode->refreshRate;
+    
+    // GLFW olayları yalnızca ana iş parçacığında işlenebilir - render ayrı iş parçacığına taşınır,
+    // ana iş parçacığı olayları bekler ve geldikleri anda zaman damgasıyla kuyruğa yazar
+    int exitCode = 0;
+    std::thread renderThread([&]() {
+        exitCode = runRenderer(window, options);
+        renderThreadDone = true;
+        glfwPostEmptyEvent();
+    });
+    while (!renderThreadDone)
+        glfwWaitEvents();
+    renderThread.join();
+    
+    if (droppedInputEvents > 0)
+        std::cerr << "Uyarı: girdi kuyruğu doldu, " << droppedInputEvents << " olay düşürüldü" << std::endl;
     
     // GLFW'yi sonlandır
     glfwTerminate();
-    return 0;
+    return exitCode;
 }
\ No newline at end of file
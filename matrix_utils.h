@@ -0,0 +1,167 @@
+#ifndef MATRIX_UTILS_H
+#define MATRIX_UTILS_H
+
+#include <cmath>
+
+// Matris işlemleri için yardımcı fonksiyonlar
+namespace MatrixUtils {
+    // Model matrisini oluşturur - dünya uzayındaki konumu ve yönelimi belirler
+    inline void createModelMatrix(float* matrix, float angleX, float angleY) {
+        // Birim matris ile başla
+        for (int i = 0; i < 16; i++) {
+            matrix[i] = 0.0f;
+        }
+        matrix[0] = matrix[5] = matrix[10] = matrix[15] = 1.0f;
+        
+        // X ekseni etrafında döndürme
+        float cosX = cos(angleX);
+        float sinX = sin(angleX);
+        
+        // Y ekseni etrafında döndürme
+        float cosY = cos(angleY);
+        float sinY = sin(angleY);
+        
+        // Döndürme matrisini oluştur (X ve Y ekseni etrafında)
+        matrix[0] = cosY;
+        matrix[2] = -sinY;
+        matrix[4] = sinX * sinY;
+        matrix[5] = cosX;
+        matrix[6] = sinX * cosY;
+        matrix[8] = -cosX * sinY;
+        matrix[9] = -sinX;
+        matrix[10] = cosX * cosY;
+    }
+    
+    // Görüntüleme matrisini oluşturur - kamera konumunu ve bakış yönünü belirler
+    inline void createViewMatrix(float* matrix, float* position, float* target, float* up) {
+        // Bakış yönü vektörünü hesapla (kameradan hedefe doğru)
+        float direction[3];
+        for (int i = 0; i < 3; i++) {
+            direction[i] = target[i] - position[i];
+        }
+        
+        // Vektörü normalize et
+        float length = sqrt(direction[0] * direction[0] + direction[1] * direction[1] + direction[2] * direction[2]);
+        for (int i = 0; i < 3; i++) {
+            direction[i] /= length;
+        }
+        
+        // Sağ vektörünü hesapla (up vektörü ile bakış yönü vektörünün çapraz çarpımı)
+        float right[3];
+        right[0] = up[1] * direction[2] - up[2] * direction[1];
+        right[1] = up[2] * direction[0] - up[0] * direction[2];
+        right[2] = up[0] * direction[1] - up[1] * direction[0];
+        
+        // Right vektörünü normalize et
+        length = sqrt(right[0] * right[0] + right[1] * right[1] + right[2] * right[2]);
+        for (int i = 0; i < 3; i++) {
+            right[i] /= length;
+        }
+        
+        // Yeni yukarı vektörünü hesapla (bakış yönü ve sağ vektörünün çapraz çarpımı)
+        float newUp[3];
+        newUp[0] = direction[1] * right[2] - direction[2] * right[1];
+        newUp[1] = direction[2] * right[0] - direction[0] * right[2];
+        newUp[2] = direction[0] * right[1] - direction[1] * right[0];
+        
+        // Birim matris ile başla
+        for (int i = 0; i < 16; i++) {
+            matrix[i] = 0.0f;
+        }
+        
+        // Görüntüleme matrisi oluştur
+        matrix[0] = right[0];
+        matrix[4] = right[1];
+        matrix[8] = right[2];
+        
+        matrix[1] = newUp[0];
+        matrix[5] = newUp[1];
+        matrix[9] = newUp[2];
+        
+        matrix[2] = -direction[0];
+        matrix[6] = -direction[1];
+        matrix[10] = -direction[2];
+        
+        matrix[15] = 1.0f;
+        
+        // Kamera konumunu matriste ayarla
+        matrix[12] = -(right[0] * position[0] + right[1] * position[1] + right[2] * position[2]);
+        matrix[13] = -(newUp[0] * position[0] + newUp[1] * position[1] + newUp[2] * position[2]);
+        matrix[14] = (direction[0] * position[0] + direction[1] * position[1] + direction[2] * position[2]);
+    }
+    
+    // Perspektif projeksiyon matrisini oluşturur - 3D görüntüyü 2D ekrana yansıtır
+    inline void createPerspectiveMatrix(float* matrix, float fov, float aspect, float near, float far) {
+        // Matris elemanlarını sıfırla
+        for (int i = 0; i < 16; i++) {
+            matrix[i] = 0.0f;
+        }
+        
+        float tanHalfFovy = tan(fov / 2.0f);
+        
+        matrix[0] = 1.0f / (aspect * tanHalfFovy); // X ekseni için skala faktörü
+        matrix[5] = 1.0f / tanHalfFovy;            // Y ekseni için skala faktörü
+        matrix[10] = -(far + near) / (far - near);  // Z değerini normalize etme
+        matrix[11] = -1.0f;                        // W bileşeni için çarpan
+        matrix[14] = -(2.0f * far * near) / (far - near); // Perspektif için öteleme
+    }
+    
+    // Ortografik projeksiyon matrisini oluşturur - paralel ışınlı kameralar (ör. ışık/gölge görünümü) için
+    inline void createOrthographicMatrix(float* matrix, float left, float right, float bottom, float top, float near, float far) {
+        // Matris elemanlarını sıfırla
+        for (int i = 0; i < 16; i++) {
+            matrix[i] = 0.0f;
+        }
+        
+        matrix[0] = 2.0f / (right - left);
+        matrix[5] = 2.0f / (top - bottom);
+        matrix[10] = -2.0f / (far - near);
+        matrix[12] = -(right + left) / (right - left);
+        matrix[13] = -(top + bottom) / (top - bottom);
+        matrix[14] = -(far + near) / (far - near);
+        matrix[15] = 1.0f;
+    }
+    
+    // İki 4x4 matrisi çarpar (sütun öncelikli, sonuç = a * b)
+    inline void multiply(float* result, const float* a, const float* b) {
+        float temp[16];
+        for (int col = 0; col < 4; col++) {
+            for (int row = 0; row < 4; row++) {
+                float sum = 0.0f;
+                for (int k = 0; k < 4; k++) {
+                    sum += a[k * 4 + row] * b[col * 4 + k];
+                }
+                temp[col * 4 + row] = sum;
+            }
+        }
+        for (int i = 0; i < 16; i++) {
+            result[i] = temp[i];
+        }
+    }
+    
+    // Görünüm-projeksiyon matrisinden altı kesik piramit düzlemini çıkarır (Gribb-Hartmann)
+    // Her düzlem (a, b, c, d) normalize edilir; a*x + b*y + c*z + d >= 0 içerideki noktalar içindir
+    inline void extractFrustumPlanes(float planes[6][4], const float* m) {
+        for (int i = 0; i < 6; i++) {
+            int row = i / 2;
+            float sign = (i % 2 == 0) ? 1.0f : -1.0f;
+            for (int j = 0; j < 4; j++) {
+                planes[i][j] = m[j * 4 + 3] + sign * m[j * 4 + row];
+            }
+            float length = sqrt(planes[i][0] * planes[i][0] + planes[i][1] * planes[i][1] + planes[i][2] * planes[i][2]);
+            for (int j = 0; j < 4; j++) {
+                planes[i][j] /= length;
+            }
+        }
+    }
+
+    // createViewMatrix ile oluşturulmuş (dönüş + öteleme) görünüm matrisinden kamera konumunu çıkarır
+    // Dönüş kısmı ortonormal olduğundan konum = -Rᵀ * t
+    inline void extractCameraPosition(float* position, const float* view) {
+        for (int i = 0; i < 3; i++) {
+            position[i] = -(view[i * 4 + 0] * view[12] + view[i * 4 + 1] * view[13] + view[i * 4 + 2] * view[14]);
+        }
+    }
+}
+
+#endif // MATRIX_UTILS_H
@@ -0,0 +1,346 @@
+#include "multiview.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+#include "clustered_lights.h"
+#include "matrix_utils.h"
+#include "parallel.h"
+#include "shader_permutations.h"
+
+void finalizeView(View& view) {
+    MatrixUtils::multiply(view.viewProjection, view.projection, view.view);
+    MatrixUtils::extractFrustumPlanes(view.planes, view.viewProjection);
+}
+
+void buildViews(std::vector<View>& views, unsigned int viewCount, const float* orbitView,
+                int width, int height, float fov, float nearPlane, float farPlane,
+                unsigned int sceneFramebuffer, unsigned int auxiliaryFramebuffer, int auxiliarySize) {
+    views.clear();
+    unsigned int cameraCount = std::min(viewCount, 4u);
+    bool auxiliary = viewCount >= 5;
+
+    // Tek kamerada tüm ekran, aksi halde 2x2 ızgara (sol üstten başlayarak)
+    int cellWidth = cameraCount == 1 ? width : width / 2;
+    int cellHeight = cameraCount == 1 ? height : height / 2;
+    float aspect = (float)cellWidth / (float)std::max(cellHeight, 1);
+
+    // Sabit yardımcı kameralar: üst, ön, yan
+    float eyes[3][3] = { { 0.0f, 25.0f, 0.0f }, { 0.0f, 2.0f, 25.0f }, { 25.0f, 2.0f, 0.0f } };
+    float ups[3][3] = { { 0.0f, 0.0f, -1.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 1.0f, 0.0f } };
+    float target[3] = { 0.0f, 0.0f, 0.0f };
+
+    for (unsigned int i = 0; i < cameraCount; i++) {
+        View view;
+        if (i == 0) {
+            std::memcpy(view.view, orbitView, sizeof(view.view));
+        } else {
+            MatrixUtils::createViewMatrix(view.view, eyes[i - 1], target, ups[i - 1]);
+        }
+        MatrixUtils::createPerspectiveMatrix(view.projection, fov, aspect, nearPlane, farPlane);
+
+        int column = cameraCount == 1 ? 0 : i % 2;
+        int row = cameraCount == 1 ? 0 : 1 - (int)(i / 2);
+        view.viewport[0] = column * cellWidth;
+        view.viewport[1] = row * cellHeight;
+        view.viewport[2] = cellWidth;
+        view.viewport[3] = cellHeight;
+        view.framebuffer = sceneFramebuffer;
+        view.depthOnly = false;
+        finalizeView(view);
+        views.push_back(view);
+    }
+
+    // Gölge haritası tarzı yardımcı kamera - ışık yönünden ortografik, yalnızca derinlik
+    if (auxiliary) {
+        View view;
+        float lightEye[3] = { 15.0f, 30.0f, 9.0f };
+        float lightUp[3] = { 0.0f, 1.0f, 0.0f };
+        MatrixUtils::createViewMatrix(view.view, lightEye, target, lightUp);
+        MatrixUtils::createOrthographicMatrix(view.projection, -20.0f, 20.0f, -20.0f, 20.0f, 1.0f, 70.0f);
+        view.viewport[0] = 0;
+        view.viewport[1] = 0;
+        view.viewport[2] = auxiliarySize;
+        view.viewport[3] = auxiliarySize;
+        view.framebuffer = auxiliaryFramebuffer;
+        view.depthOnly = true;
+        finalizeView(view);
+        views.push_back(view);
+    }
+}
+
+bool MultiViewRenderer::init(const std::string& shaderDir, unsigned int cubeVAOIn, unsigned int cubeVBO, unsigned int cubeEBO) {
+    cubeVAO = cubeVAOIn;
+    shadedShader.reset(new Shader((shaderDir + "multiview_vertex.glsl").c_str(), (shaderDir + "fragment.glsl").c_str(),
+                                  shaderFeatureDefines(ShaderFeature::Lighting)));
+    depthShader.reset(new Shader((shaderDir + "multiview_vertex.glsl").c_str(), (shaderDir + "depth_fragment.glsl").c_str()));
+
+    // Gölge ve küme örnekleyicileri ayrı birimlere - kullanılmasalar da türleri çakışmamalı
+    setLightingTextureUnits(*shadedShader);
+
+    // Her iki program da Views bloğunu 0 numaralı bağlama noktasından okur
+    Shader* programs[] = { shadedShader.get(), depthShader.get() };
+    for (Shader* program : programs) {
+        unsigned int blockIndex = glGetUniformBlockIndex(program->ID, "Views");
+        if (blockIndex != GL_INVALID_INDEX) {
+            glUniformBlockBinding(program->ID, blockIndex, 0);
+        }
+    }
+
+    glGenBuffers(1, &viewsUBO);
+    glBindBuffer(GL_UNIFORM_BUFFER, viewsUBO);
+    glBufferData(GL_UNIFORM_BUFFER, MAX_VIEWS * 16 * sizeof(float), NULL, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    // Küp geometrisi + birleşik örnek tamponu; örnek işaretçileri her komutta kaydırılır
+    glGenVertexArrays(1, &streamVAO);
+    glGenBuffers(1, &combinedVBO);
+    glBindVertexArray(streamVAO);
+    glBindBuffer(GL_ARRAY_BUFFER, cubeVBO);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, cubeEBO);
+    setCubeVertexAttributes();
+    glEnableVertexAttribArray(INSTANCE_OFFSET_LOCATION);
+    glVertexAttribDivisor(INSTANCE_OFFSET_LOCATION, 1);
+    glEnableVertexAttribArray(INSTANCE_COLOR_LOCATION);
+    glVertexAttribDivisor(INSTANCE_COLOR_LOCATION, 1);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // Yardımcı kamera için yalnızca derinlik hedefi
+    glGenTextures(1, &auxDepthTexture);
+    glBindTexture(GL_TEXTURE_2D, auxDepthTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, auxSize, auxSize, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glGenFramebuffers(1, &auxFBO);
+    glBindFramebuffer(GL_FRAMEBUFFER, auxFBO);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, auxDepthTexture, 0);
+    const GLenum noColor = GL_NONE;
+    glDrawBuffers(1, &noColor);
+    glReadBuffer(GL_NONE);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        std::cerr << "HATA: Yardımcı görünüm framebuffer'ı eksik" << std::endl;
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    return true;
+}
+
+void MultiViewRenderer::setInstances(const std::vector<CubeInstance>& newInstances) {
+    instances = newInstances;
+    viewMasks.resize(instances.size());
+}
+
+void MultiViewRenderer::cullAndRecord(const std::vector<View>& views) {
+    auto start = std::chrono::steady_clock::now();
+    const size_t count = instances.size();
+    const unsigned int viewCount = std::min<unsigned int>(static_cast<unsigned int>(views.size()), MAX_VIEWS);
+    const unsigned int threads = Parallel::workerCount();
+
+    // 1. Tek geçiş: her örnek tüm görünümlere karşı test edilir, sonuç bit maskesinde tutulur
+    std::vector<unsigned int> counts(threads * MAX_VIEWS, 0);
+    Parallel::forRange(count, threads, [&](size_t begin, size_t end, unsigned int t) {
+        unsigned int* threadCounts = &counts[t * MAX_VIEWS];
+        for (size_t i = begin; i < end; i++) {
+            const CubeInstance& instance = instances[i];
+            float radius = 0.8660254f * instance.scale; // Birim küpün çevrel küresi
+            uint32_t mask = 0;
+            for (unsigned int v = 0; v < viewCount; v++) {
+                const float (*planes)[4] = views[v].planes;
+                bool inside = true;
+                for (int p = 0; p < 6 && inside; p++) {
+                    float distance = planes[p][0] * instance.offset[0] + planes[p][1] * instance.offset[1] +
+                                     planes[p][2] * instance.offset[2] + planes[p][3];
+                    inside = distance >= -radius;
+                }
+                if (inside) {
+                    mask |= 1u << v;
+                    threadCounts[v]++;
+                }
+            }
+            viewMasks[i] = mask;
+        }
+    });
+
+    // 2. Görünüm başına bölge başlangıçları - bölgeler görünüm sırasıyla art arda dizilir
+    std::vector<unsigned int> offsets(threads * MAX_VIEWS, 0);
+    std::vector<unsigned int> viewStart(viewCount, 0);
+    visiblePerView.assign(viewCount, 0);
+    unsigned int running = 0;
+    for (unsigned int v = 0; v < viewCount; v++) {
+        viewStart[v] = running;
+        for (unsigned int t = 0; t < threads; t++) {
+            offsets[t * MAX_VIEWS + v] = running;
+            running += counts[t * MAX_VIEWS + v];
+        }
+        visiblePerView[v] = running - viewStart[v];
+    }
+
+    // 3. Görünür örnekleri birleşik tampona dağıt
+    combined.resize(running);
+    Parallel::forRange(count, threads, [&](size_t begin, size_t end, unsigned int t) {
+        unsigned int* threadOffsets = &offsets[t * MAX_VIEWS];
+        for (size_t i = begin; i < end; i++) {
+            uint32_t mask = viewMasks[i];
+            for (unsigned int v = 0; mask != 0; v++, mask >>= 1) {
+                if (mask & 1u) {
+                    combined[threadOffsets[v]++] = instances[i];
+                }
+            }
+        }
+    });
+
+    // Tek yükleme - tüm görünümlerin örnekleri
+    glBindBuffer(GL_ARRAY_BUFFER, combinedVBO);
+    if (running > combinedCapacity) {
+        combinedCapacity = running;
+        glBufferData(GL_ARRAY_BUFFER, combinedCapacity * sizeof(CubeInstance), combined.data(), GL_DYNAMIC_DRAW);
+    } else if (running > 0) {
+        glBufferData(GL_ARRAY_BUFFER, combinedCapacity * sizeof(CubeInstance), NULL, GL_DYNAMIC_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, running * sizeof(CubeInstance), combined.data());
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // 4. Komut akışı: her görünüm için merkezdeki küp ve görünür örnekler
+    commands.clear();
+    for (unsigned int v = 0; v < viewCount; v++) {
+        commands.push_back({ v, 0, 0 });
+        if (visiblePerView[v] > 0) {
+            commands.push_back({ v, viewStart[v], visiblePerView[v] });
+        }
+    }
+
+    auto stop = std::chrono::steady_clock::now();
+    lastCullMs = std::chrono::duration<float, std::milli>(stop - start).count();
+}
+
+void MultiViewRenderer::execute(const std::vector<View>& views, const float* centerModel, float ambientStrength) {
+    static const float identity[16] = { 1, 0, 0, 0,  0, 1, 0, 0,  0, 0, 1, 0,  0, 0, 0, 1 };
+
+    // Tüm görünüm matrisleri tek seferde yüklenir
+    const unsigned int viewCount = std::min<unsigned int>(static_cast<unsigned int>(views.size()), MAX_VIEWS);
+    float matrices[MAX_VIEWS * 16];
+    for (unsigned int v = 0; v < viewCount; v++) {
+        std::memcpy(&matrices[v * 16], views[v].viewProjection, 16 * sizeof(float));
+    }
+    glBindBuffer(GL_UNIFORM_BUFFER, viewsUBO);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, viewCount * 16 * sizeof(float), matrices);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    glBindBufferBase(GL_UNIFORM_BUFFER, 0, viewsUBO);
+
+    glEnable(GL_SCISSOR_TEST);
+    int currentView = -1;
+    Shader* shader = NULL;
+    for (const ViewDrawCommand& command : commands) {
+        // Görünüm değiştiğinde hedef, viewport ve program ayarlanır
+        if ((int)command.viewIndex != currentView) {
+            const View& view = views[command.viewIndex];
+            glBindFramebuffer(GL_FRAMEBUFFER, view.framebuffer);
+            glViewport(view.viewport[0], view.viewport[1], view.viewport[2], view.viewport[3]);
+            glScissor(view.viewport[0], view.viewport[1], view.viewport[2], view.viewport[3]);
+            if (view.depthOnly) {
+                glClear(GL_DEPTH_BUFFER_BIT);
+                shader = depthShader.get();
+                shader->use();
+            } else {
+                glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+                shader = shadedShader.get();
+                shader->use();
+                shader->setFloat("ambientStrength", ambientStrength);
+                float eye[3];
+                MatrixUtils::extractCameraPosition(eye, view.view);
+                shader->setVec3("viewPosition", eye[0], eye[1], eye[2]);
+            }
+            shader->setInt("viewIndex", (int)command.viewIndex);
+            currentView = (int)command.viewIndex;
+        }
+
+        if (command.instanceCount == 0) {
+            // Shader örnek özniteliklerini her zaman okur - cubeVAO'da kapalı oldukları için sabit değerleri
+            // her çizimden önce ayarlanır (2. ve 3. konumlar dizi olarak kullanıldıktan sonra güvenilir değil)
+            shader->setMat4("model", centerModel);
+            glBindVertexArray(cubeVAO);
+            setDefaultInstanceAttributes();
+            glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+        } else {
+            // GL 3.3'te taban örnek (base instance) yok - örnek işaretçileri bölgenin başına kaydırılır
+            size_t base = (size_t)command.firstInstance * sizeof(CubeInstance);
+            shader->setMat4("model", identity);
+            glBindVertexArray(streamVAO);
+            glBindBuffer(GL_ARRAY_BUFFER, combinedVBO);
+            glVertexAttribPointer(INSTANCE_OFFSET_LOCATION, 4, GL_FLOAT, GL_FALSE, sizeof(CubeInstance), (void*)base);
+            glVertexAttribPointer(INSTANCE_COLOR_LOCATION, 4, GL_FLOAT, GL_FALSE, sizeof(CubeInstance), (void*)(base + 4 * sizeof(float)));
+            glDrawElementsInstanced(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0, command.instanceCount);
+        }
+    }
+    glDisable(GL_SCISSOR_TEST);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void MultiViewRenderer::destroy() {
+    glDeleteVertexArrays(1, &streamVAO);
+    glDeleteBuffers(1, &combinedVBO);
+    glDeleteBuffers(1, &viewsUBO);
+    glDeleteFramebuffers(1, &auxFBO);
+    glDeleteTextures(1, &auxDepthTexture);
+    streamVAO = combinedVBO = viewsUBO = auxFBO = auxDepthTexture = 0;
+    combinedCapacity = 0;
+    if (shadedShader) {
+        shadedShader->destroy();
+        shadedShader.reset();
+    }
+    if (depthShader) {
+        depthShader->destroy();
+        depthShader.reset();
+    }
+}
+
+void runMultiViewBenchmark(MultiViewRenderer& renderer, RenderTarget& scene, const float* orbitView,
+                           const float* centerModel, float fov, float nearPlane, float farPlane) {
+    const int warmupFrames = 3;
+    const int measuredFrames = 30;
+    std::vector<View> views;
+
+    std::cout << "Görünüm başına maliyet (" << scene.width << "x" << scene.height << ", "
+              << measuredFrames << " kare ortalaması)" << std::endl;
+    std::cout << std::setw(10) << "görünüm" << std::setw(16) << "eleme (ms)" << std::setw(14) << "kare (ms)"
+              << std::setw(16) << "ek görünüm (ms)" << std::setw(14) << "görünür" << std::endl;
+
+    double previousFrameMs = 0.0;
+    for (unsigned int viewCount = 1; viewCount <= 5; viewCount++) {
+        buildViews(views, viewCount, orbitView, scene.width, scene.height, fov, nearPlane, farPlane,
+                   scene.FBO, renderer.auxiliaryFramebuffer(), renderer.auxiliarySize());
+
+        double cullMs = 0.0;
+        double frameMs = 0.0;
+        unsigned int visible = 0;
+        for (int frame = 0; frame < warmupFrames + measuredFrames; frame++) {
+            auto start = std::chrono::steady_clock::now();
+            renderer.cullAndRecord(views);
+            renderer.execute(views, centerModel, 0.3f);
+            glFinish();
+            auto stop = std::chrono::steady_clock::now();
+
+            if (frame >= warmupFrames) {
+                cullMs += renderer.lastCullMs;
+                frameMs += std::chrono::duration<double, std::milli>(stop - start).count();
+            }
+        }
+        for (unsigned int count : renderer.visiblePerView) {
+            visible += count;
+        }
+
+        cullMs /= measuredFrames;
+        frameMs /= measuredFrames;
+        std::cout << std::setw(10) << viewCount << std::setw(16) << std::fixed << std::setprecision(3) << cullMs
+                  << std::setw(14) << frameMs << std::setw(16) << (viewCount > 1 ? frameMs - previousFrameMs : 0.0)
+                  << std::setw(14) << visible << std::endl;
+        previousFrameMs = frameMs;
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
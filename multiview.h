@@ -0,0 +1,89 @@
+#ifndef MULTIVIEW_H
+#define MULTIVIEW_H
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "render_target.h"
+#include "scene.h"
+#include "shader.h"
+
+// multiview_vertex.glsl'deki Views bloğunun boyutu
+const unsigned int MAX_VIEWS = 8;
+
+// Tek bir kamera görünümü
+struct View {
+    float view[16];
+    float projection[16];
+    float viewProjection[16];
+    float planes[6][4];     // Kesik piramit düzlemleri (viewProjection'dan)
+    int viewport[4];        // x, y, genişlik, yükseklik
+    unsigned int framebuffer; // Hedef framebuffer
+    bool depthOnly;         // Gölge haritası tarzı yardımcı kameralar yalnızca derinlik yazar
+};
+
+// Görünüm matrislerinden düzlemleri ve görünüm-projeksiyonu doldurur
+void finalizeView(View& view);
+
+// Yörünge kamerası ve sabit yardımcı kameralardan viewCount kadar görünüm kurar:
+// 0: yörünge, 1: üst, 2: ön, 3: yan (2x2 ızgara), 4: ışık yönünden ortografik derinlik kamerası
+void buildViews(std::vector<View>& views, unsigned int viewCount, const float* orbitView,
+                int width, int height, float fov, float nearPlane, float farPlane,
+                unsigned int sceneFramebuffer, unsigned int auxiliaryFramebuffer, int auxiliarySize);
+
+// Komut akışındaki tek bir çizim
+struct ViewDrawCommand {
+    unsigned int viewIndex;
+    unsigned int firstInstance; // Birleşik örnek tamponundaki başlangıç
+    unsigned int instanceCount; // 0 ise merkezdeki (örneklenmemiş) küp çizilir
+};
+
+// Birden fazla görünümü tek bir eleme geçişi ve tek bir komut akışıyla çizer
+class MultiViewRenderer {
+public:
+    float lastCullMs = 0.0f;                    // Son eleme + kayıt süresi
+    std::vector<unsigned int> visiblePerView;   // Görünüm başına görünür örnek sayısı
+
+    bool init(const std::string& shaderDir, unsigned int cubeVAO, unsigned int cubeVBO, unsigned int cubeEBO);
+
+    void setInstances(const std::vector<CubeInstance>& newInstances);
+
+    // Sahne örnekleri bir kez dolaşılır, her örnek tüm görünümlere karşı test edilir;
+    // görünür örnekler görünüm sırasıyla tek bir tampona yazılır ve komut akışı kaydedilir
+    void cullAndRecord(const std::vector<View>& views);
+
+    // Kaydedilen komut akışını çalıştırır
+    void execute(const std::vector<View>& views, const float* centerModel, float ambientStrength);
+
+    // Yardımcı (yalnızca derinlik) görünümün hedefi
+    unsigned int auxiliaryFramebuffer() const { return auxFBO; }
+    int auxiliarySize() const { return auxSize; }
+
+    void destroy();
+
+private:
+    std::unique_ptr<Shader> shadedShader;
+    std::unique_ptr<Shader> depthShader;
+    unsigned int cubeVAO = 0;
+    unsigned int streamVAO = 0;      // Küp geometrisi + birleşik örnek tamponu
+    unsigned int combinedVBO = 0;
+    unsigned int combinedCapacity = 0;
+    unsigned int viewsUBO = 0;
+    unsigned int auxFBO = 0;
+    unsigned int auxDepthTexture = 0;
+    int auxSize = 1024;
+
+    std::vector<CubeInstance> instances;
+    std::vector<CubeInstance> combined;
+    std::vector<uint32_t> viewMasks;         // Örnek başına görünür olduğu görünümlerin bit maskesi
+    std::vector<ViewDrawCommand> commands;
+};
+
+// Ek her görünümün maliyetini (eleme/kayıt ve toplam kare süresi) ölçer ve yazdırır
+void runMultiViewBenchmark(MultiViewRenderer& renderer, RenderTarget& scene, const float* orbitView,
+                           const float* centerModel, float fov, float nearPlane, float farPlane);
+
+#endif // MULTIVIEW_H
@@ -0,0 +1,337 @@
+#include "occlusion.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+#include "parallel.h"
+
+// CPU yolunda okunacak seviyenin en büyük genişliği (texel)
+const int CPU_HIZ_MAX_WIDTH = 64;
+
+const char* cullingModeName(CullingMode mode) {
+    switch (mode) {
+        case CullingMode::Off: return "kapalı";
+        case CullingMode::GPU: return "GPU (transform feedback)";
+        case CullingMode::CPU: return "CPU (önceki kare)";
+    }
+    return "?";
+}
+
+bool OcclusionCuller::init(const std::string& shaderDir, unsigned int cubeVBO, unsigned int cubeEBO) {
+    hiZShader.reset(new Shader((shaderDir + "fullscreen_vertex.glsl").c_str(), (shaderDir + "hiz_fragment.glsl").c_str()));
+    cullShader.reset(new Shader((shaderDir + "cull_vertex.glsl").c_str(), NULL, (shaderDir + "cull_geometry.glsl").c_str(),
+                                { "outOffset", "outColor" }));
+
+    allBatch.create(cubeVBO, cubeEBO);
+    visibleBatches[0].create(cubeVBO, cubeEBO);
+    visibleBatches[1].create(cubeVBO, cubeEBO);
+
+    // Eleme girdisi: her örnek tek bir nokta, öznitelikler CubeInstance ile aynı düzende
+    glGenVertexArrays(1, &cullVAO);
+    glBindVertexArray(cullVAO);
+    glBindBuffer(GL_ARRAY_BUFFER, allBatch.instanceVBO);
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(CubeInstance), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(CubeInstance), (void*)(4 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glGenVertexArrays(1, &emptyVAO);
+    glGenQueries(1, &feedbackQuery);
+    glGenBuffers(1, &readbackPBO);
+    return true;
+}
+
+void OcclusionCuller::setInstances(const std::vector<CubeInstance>& newInstances) {
+    instances = newInstances;
+    allBatch.upload(instances.data(), instanceCount());
+
+    // Görünür tamponlar en kötü durumda tüm örnekleri alabilmeli
+    visibleBatches[0].upload(instances.data(), instanceCount());
+    visibleBatches[1].upload(instances.data(), instanceCount());
+    visibleCount = instanceCount();
+    feedbackPending = false;
+    visibleFlags.resize(instances.size());
+}
+
+void OcclusionCuller::createHiZ(int width, int height) {
+    destroyHiZ();
+    hiZWidth = width;
+    hiZHeight = height;
+    hiZLevels = 1 + static_cast<int>(std::floor(std::log2(static_cast<float>(std::max(width, height)))));
+
+    // 1x1'e kadar tam mip zinciri - texelFetch için doku eksiksiz olmalı
+    glGenTextures(1, &hiZTexture);
+    glBindTexture(GL_TEXTURE_2D, hiZTexture);
+    for (int level = 0; level < hiZLevels; level++) {
+        glTexImage2D(GL_TEXTURE_2D, level, GL_R32F, std::max(1, width >> level), std::max(1, height >> level),
+                     0, GL_RED, GL_FLOAT, NULL);
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, hiZLevels - 1);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glGenFramebuffers(1, &hiZFBO);
+
+    // CPU için okunacak seviye: genişliği CPU_HIZ_MAX_WIDTH'i geçmeyen ilk seviye
+    readbackLevel = 0;
+    while (readbackLevel < hiZLevels - 1 && (width >> readbackLevel) > CPU_HIZ_MAX_WIDTH) {
+        readbackLevel++;
+    }
+    readbackWidth = std::max(1, width >> readbackLevel);
+    readbackHeight = std::max(1, height >> readbackLevel);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, readbackPBO);
+    glBufferData(GL_PIXEL_PACK_BUFFER, readbackWidth * readbackHeight * sizeof(float), NULL, GL_STREAM_READ);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    readbackPending = false;
+}
+
+void OcclusionCuller::destroyHiZ() {
+    if (hiZTexture != 0) {
+        glDeleteTextures(1, &hiZTexture);
+        glDeleteFramebuffers(1, &hiZFBO);
+    }
+    hiZTexture = hiZFBO = 0;
+    hiZWidth = hiZHeight = hiZLevels = 0;
+    hiZValid = false;
+}
+
+void OcclusionCuller::buildHiZ(const RenderTarget& scene, const float* viewProjection, bool readback) {
+    if (scene.width != hiZWidth || scene.height != hiZHeight) {
+        createHiZ(scene.width, scene.height);
+    }
+
+    glDisable(GL_DEPTH_TEST);
+    glBindFramebuffer(GL_FRAMEBUFFER, hiZFBO);
+    glBindVertexArray(emptyVAO);
+    glActiveTexture(GL_TEXTURE0);
+    hiZShader->use();
+    hiZShader->setInt("source", 0);
+
+    // 0. seviye: derinlik dokusunun kopyası
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, hiZTexture, 0);
+    glViewport(0, 0, hiZWidth, hiZHeight);
+    glBindTexture(GL_TEXTURE_2D, scene.depthTexture);
+    hiZShader->setBool("downsample", false);
+    hiZShader->setIVec2("sourceSize", hiZWidth, hiZHeight);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    // Diğer seviyeler: bir öncekinin en büyük değeri
+    // Okunan seviye taban/tavan seviye yapılır, böylece yazılan seviye ile geri besleme döngüsü oluşmaz
+    glBindTexture(GL_TEXTURE_2D, hiZTexture);
+    hiZShader->setBool("downsample", true);
+    for (int level = 1; level < hiZLevels; level++) {
+        int sourceWidth = std::max(1, hiZWidth >> (level - 1));
+        int sourceHeight = std::max(1, hiZHeight >> (level - 1));
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, level - 1);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, level - 1);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, hiZTexture, level);
+        glViewport(0, 0, std::max(1, hiZWidth >> level), std::max(1, hiZHeight >> level));
+        hiZShader->setIVec2("sourceSize", sourceWidth, sourceHeight);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, hiZLevels - 1);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    // CPU yolu: kaba seviyeyi PBO'ya kopyala - sonuç bir sonraki karede beklemeden okunur
+    if (readback) {
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, hiZTexture, readbackLevel);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, readbackPBO);
+        glReadPixels(0, 0, readbackWidth, readbackHeight, GL_RED, GL_FLOAT, 0);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        std::memcpy(readbackViewProjection, viewProjection, sizeof(readbackViewProjection));
+        readbackPending = true;
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glEnable(GL_DEPTH_TEST);
+
+    std::memcpy(hiZViewProjection, viewProjection, sizeof(hiZViewProjection));
+    hiZValid = true;
+}
+
+void OcclusionCuller::cullGPU() {
+    if (!hiZValid || instances.empty()) {
+        return;
+    }
+    InstanceBatch& target = visibleBatches[1 - drawIndex];
+
+    cullShader->use();
+    cullShader->setMat4("viewProjection", hiZViewProjection);
+    cullShader->setInt("hiZ", 0);
+    cullShader->setVec2("hiZSize", static_cast<float>(hiZWidth), static_cast<float>(hiZHeight));
+    cullShader->setInt("hiZLevels", hiZLevels);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, hiZTexture);
+
+    // Rasterizer kapalı - yalnızca görünür örnekler görünür tampona yazılır
+    glEnable(GL_RASTERIZER_DISCARD);
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, target.instanceVBO);
+    glBeginQuery(GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN, feedbackQuery);
+    glBeginTransformFeedback(GL_POINTS);
+    glBindVertexArray(cullVAO);
+    glDrawArrays(GL_POINTS, 0, instanceCount());
+    glEndTransformFeedback();
+    glEndQuery(GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN);
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0);
+    glDisable(GL_RASTERIZER_DISCARD);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    feedbackPending = true;
+}
+
+void OcclusionCuller::resolveGPU() {
+    if (!feedbackPending) {
+        markAllVisible();
+        return;
+    }
+
+    // GL 3.3'te dolaylı çizim (indirect draw) yok - örnek sayısı CPU'ya okunmalı. Sorgu bir önceki
+    // karede bittiyse beklemeden okunur; bitmediyse beklemek tek seçenek (GPU bir kareden fazla geride)
+    GLuint available = 0;
+    glGetQueryObjectuiv(feedbackQuery, GL_QUERY_RESULT_AVAILABLE, &available);
+    GLuint written = 0;
+    if (available) {
+        glGetQueryObjectuiv(feedbackQuery, GL_QUERY_RESULT, &written);
+    } else {
+        auto start = std::chrono::high_resolution_clock::now();
+        glGetQueryObjectuiv(feedbackQuery, GL_QUERY_RESULT, &written);
+        auto end = std::chrono::high_resolution_clock::now();
+        feedbackStalls++;
+        feedbackStallMs += std::chrono::duration<double, std::milli>(end - start).count();
+    }
+    feedbackPending = false;
+
+    drawIndex = 1 - drawIndex;
+    visibleBatches[drawIndex].count = written;
+    visibleCount = written;
+}
+
+void OcclusionCuller::cullCPU() {
+    feedbackPending = false;
+
+    // Bir önceki karede başlatılan okuma tamamlanmış olmalı
+    if (readbackPending) {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, readbackPBO);
+        const size_t bytes = readbackWidth * readbackHeight * sizeof(float);
+        void* data = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, bytes, GL_MAP_READ_BIT);
+        if (data != NULL) {
+            cpuHiZ.resize(readbackWidth * readbackHeight);
+            std::memcpy(cpuHiZ.data(), data, bytes);
+            cpuHiZWidth = readbackWidth;
+            cpuHiZHeight = readbackHeight;
+            cpuHiZLevel = readbackLevel;
+            cpuHiZBaseWidth = hiZWidth;
+            cpuHiZBaseHeight = hiZHeight;
+            std::memcpy(cpuHiZViewProjection, readbackViewProjection, sizeof(cpuHiZViewProjection));
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        readbackPending = false;
+    }
+
+    if (cpuHiZ.empty() || instances.empty()) {
+        markAllVisible();
+        return;
+    }
+
+    Parallel::forRange(instances.size(), Parallel::workerCount(), [&](size_t begin, size_t end, unsigned int) {
+        for (size_t i = begin; i < end; i++) {
+            visibleFlags[i] = isVisibleCPU(instances[i]) ? 1 : 0;
+        }
+    });
+
+    visibleInstances.clear();
+    for (size_t i = 0; i < instances.size(); i++) {
+        if (visibleFlags[i]) {
+            visibleInstances.push_back(instances[i]);
+        }
+    }
+    visibleBatches[drawIndex].upload(visibleInstances.data(), static_cast<unsigned int>(visibleInstances.size()));
+    visibleCount = visibleBatches[drawIndex].count;
+}
+
+bool OcclusionCuller::isVisibleCPU(const CubeInstance& instance) const {
+    // cull_vertex.glsl'deki testin CPU karşılığı - tek (kaba) seviye üzerinde
+    const float* m = cpuHiZViewProjection;
+    float halfSize = 0.5f * instance.scale;
+    float minNdc[2] = { 1.0f, 1.0f };
+    float maxNdc[2] = { -1.0f, -1.0f };
+    float minDepth = 1.0f;
+
+    for (int i = 0; i < 8; i++) {
+        float x = instance.offset[0] + ((i & 1) ? halfSize : -halfSize);
+        float y = instance.offset[1] + ((i & 2) ? halfSize : -halfSize);
+        float z = instance.offset[2] + ((i & 4) ? halfSize : -halfSize);
+        float clipX = m[0] * x + m[4] * y + m[8] * z + m[12];
+        float clipY = m[1] * x + m[5] * y + m[9] * z + m[13];
+        float clipZ = m[2] * x + m[6] * y + m[10] * z + m[14];
+        float clipW = m[3] * x + m[7] * y + m[11] * z + m[15];
+        if (clipW <= 1e-4f) {
+            return true;
+        }
+        float ndcX = clipX / clipW;
+        float ndcY = clipY / clipW;
+        minNdc[0] = std::min(minNdc[0], ndcX);
+        minNdc[1] = std::min(minNdc[1], ndcY);
+        maxNdc[0] = std::max(maxNdc[0], ndcX);
+        maxNdc[1] = std::max(maxNdc[1], ndcY);
+        minDepth = std::min(minDepth, (clipZ / clipW) * 0.5f + 0.5f);
+    }
+
+    if (maxNdc[0] < -1.0f || maxNdc[1] < -1.0f || minNdc[0] > 1.0f || minNdc[1] > 1.0f || minDepth > 1.0f) {
+        return false;
+    }
+
+    // 0. seviye piksel dikdörtgeni, sonra okunan seviyenin texel'leri
+    auto toPixel = [](float ndc, int size) {
+        int pixel = static_cast<int>((ndc * 0.5f + 0.5f) * size);
+        return std::min(std::max(pixel, 0), size - 1);
+    };
+    int minTexelX = std::min(toPixel(minNdc[0], cpuHiZBaseWidth) >> cpuHiZLevel, cpuHiZWidth - 1);
+    int minTexelY = std::min(toPixel(minNdc[1], cpuHiZBaseHeight) >> cpuHiZLevel, cpuHiZHeight - 1);
+    int maxTexelX = std::min(toPixel(maxNdc[0], cpuHiZBaseWidth) >> cpuHiZLevel, cpuHiZWidth - 1);
+    int maxTexelY = std::min(toPixel(maxNdc[1], cpuHiZBaseHeight) >> cpuHiZLevel, cpuHiZHeight - 1);
+
+    for (int y = minTexelY; y <= maxTexelY; y++) {
+        for (int x = minTexelX; x <= maxTexelX; x++) {
+            if (minDepth <= cpuHiZ[y * cpuHiZWidth + x]) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void OcclusionCuller::markAllVisible() {
+    visibleBatches[drawIndex].upload(instances.data(), instanceCount());
+    visibleCount = instanceCount();
+}
+
+void OcclusionCuller::destroy() {
+    destroyHiZ();
+    allBatch.destroy();
+    visibleBatches[0].destroy();
+    visibleBatches[1].destroy();
+    glDeleteVertexArrays(1, &cullVAO);
+    glDeleteVertexArrays(1, &emptyVAO);
+    glDeleteQueries(1, &feedbackQuery);
+    glDeleteBuffers(1, &readbackPBO);
+    cullVAO = emptyVAO = feedbackQuery = readbackPBO = 0;
+    if (hiZShader) {
+        hiZShader->destroy();
+        hiZShader.reset();
+    }
+    if (cullShader) {
+        cullShader->destroy();
+        cullShader.reset();
+    }
+}
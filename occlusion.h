@@ -0,0 +1,111 @@
+#ifndef OCCLUSION_H
+#define OCCLUSION_H
+
+#include <glad/glad.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "render_target.h"
+#include "scene.h"
+#include "shader.h"
+
+// Opak küp örnekleri için oklüzyon eleme yöntemi
+enum class CullingMode {
+    Off, // Tüm örnekler çizilir
+    GPU, // Hi-Z testi vertex shader'da, görünürler geometry shader + transform feedback ile sıkıştırılır
+    CPU  // Bir önceki karenin küçültülmüş Hi-Z seviyesi okunur, test CPU'da yapılır
+};
+
+const char* cullingModeName(CullingMode mode);
+
+// Opak küp alanını Hi-Z piramidine karşı eleyip yalnızca görünür örnekleri çizer
+class OcclusionCuller {
+public:
+    unsigned int visibleCount = 0; // Son elemeden sonra çizilecek örnek sayısı
+
+    // GPU elemesinde sonucu hazır olmadığı için beklenen kareler ve toplam bekleme (resetStats() ile sıfırlanır)
+    unsigned int feedbackStalls = 0;
+    double feedbackStallMs = 0.0;
+
+    bool init(const std::string& shaderDir, unsigned int cubeVBO, unsigned int cubeEBO);
+
+    void setInstances(const std::vector<CubeInstance>& newInstances);
+    unsigned int instanceCount() const { return static_cast<unsigned int>(instances.size()); }
+
+    // Sahne derinliğinden Hi-Z piramidini oluşturur
+    // viewProjection derinliğin çizildiği matristir; eleme testleri aynı matrisle yapılır
+    // readback açıksa kaba bir seviye sonraki karedeki CPU elemesi için asenkron okunur
+    void buildHiZ(const RenderTarget& scene, const float* viewProjection, bool readback);
+    bool hasHiZ() const { return hiZValid; }
+
+    // GPU elemesi - mevcut Hi-Z ile, çizilmeyen görünür tampona yazar; sonuç bir sonraki karede kullanılır
+    void cullGPU();
+
+    // Bir önceki cullGPU sonucunu çizilecek küme yapar (kare başında, çizimlerden önce).
+    // Sayaç sorgusu normalde bir kare sonra beklemeden hazırdır; değilse beklenir ve sayılır
+    void resolveGPU();
+
+    // CPU elemesi - bir önceki buildHiZ'de okunmaya başlanan kaba seviyeyle
+    void cullCPU();
+
+    // Eleme yapmadan tüm örnekleri görünür say
+    void markAllVisible();
+
+    // Tüm örnekleri çizer (eleme kapalıyken)
+    void drawAll() const { allBatch.draw(); }
+
+    // Son elemede görünür kalan örnekleri çizer
+    void drawVisible() const { visibleBatches[drawIndex].draw(); }
+
+    void resetStats() {
+        feedbackStalls = 0;
+        feedbackStallMs = 0.0;
+    }
+
+    void destroy();
+
+private:
+    std::unique_ptr<Shader> hiZShader;
+    std::unique_ptr<Shader> cullShader;
+    InstanceBatch allBatch;          // Tüm örnekler (aynı zamanda eleme girdisi)
+    InstanceBatch visibleBatches[2]; // Görünür örnekler - biri çizilirken diğerine transform feedback yazar
+    int drawIndex = 0;               // drawVisible'ın çizdiği tampon
+    unsigned int cullVAO = 0;        // Örnekleri nokta olarak besleyen VAO
+    unsigned int emptyVAO = 0;
+    unsigned int feedbackQuery = 0;  // Diğer tampona yazılan örnek sayısı - sonraki resolveGPU'da okunur
+    bool feedbackPending = false;
+    std::vector<CubeInstance> instances;
+    std::vector<CubeInstance> visibleInstances;
+    std::vector<unsigned char> visibleFlags;
+
+    // Hi-Z piramidi
+    unsigned int hiZTexture = 0; // R32F, tam mip zinciri
+    unsigned int hiZFBO = 0;
+    int hiZWidth = 0;
+    int hiZHeight = 0;
+    int hiZLevels = 0;
+    bool hiZValid = false;
+    float hiZViewProjection[16];
+
+    // CPU yolu - kaba seviyenin PBO üzerinden gecikmeli okunması
+    unsigned int readbackPBO = 0;
+    int readbackLevel = 0;
+    int readbackWidth = 0;
+    int readbackHeight = 0;
+    bool readbackPending = false;
+    float readbackViewProjection[16];
+    std::vector<float> cpuHiZ;
+    int cpuHiZWidth = 0;
+    int cpuHiZHeight = 0;
+    int cpuHiZLevel = 0;
+    int cpuHiZBaseWidth = 0;  // Okunan seviyenin ait olduğu 0. seviye boyutu
+    int cpuHiZBaseHeight = 0;
+    float cpuHiZViewProjection[16];
+
+    void createHiZ(int width, int height);
+    void destroyHiZ();
+    bool isVisibleCPU(const CubeInstance& instance) const;
+};
+
+#endif // OCCLUSION_H
@@ -0,0 +1,54 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+// Basit paralel döngü yardımcıları - CPU tarafındaki toplu işler için
+namespace Parallel {
+    // Kullanılacak iş parçacığı sayısı (en az 1)
+    inline unsigned int workerCount() {
+        unsigned int count = std::thread::hardware_concurrency();
+        return count == 0 ? 1 : count;
+    }
+
+    // [0, count) aralığını parçalara böler ve her parçayı ayrı iş parçacığında çalıştırır
+    // fn(begin, end, threadIndex) şeklinde çağrılır; parça sayısı threadCount'u geçmez
+    template <typename Func>
+    void forRange(size_t count, unsigned int threadCount, Func fn) {
+        if (count == 0) {
+            return;
+        }
+        threadCount = std::max(1u, std::min<unsigned int>(threadCount, static_cast<unsigned int>(count)));
+
+        // Tek parça için iş parçacığı açma maliyetine girme
+        if (threadCount == 1) {
+            fn(size_t(0), count, 0u);
+            return;
+        }
+
+        size_t chunk = (count + threadCount - 1) / threadCount;
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount - 1);
+        for (unsigned int t = 1; t < threadCount; t++) {
+            size_t begin = t * chunk;
+            size_t end = std::min(count, begin + chunk);
+            threads.emplace_back([=]() {
+                if (begin < end) {
+                    fn(begin, end, t);
+                }
+            });
+        }
+
+        // İlk parça çağıran iş parçacığında çalışır
+        fn(size_t(0), std::min(count, chunk), 0u);
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+}
+
+#endif // PARALLEL_H
@@ -0,0 +1,453 @@
+#include "particles.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+#include "parallel.h"
+
+// x86'da SSE her zaman var; diğer mimarilerde skaler yol kullanılır
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PARTICLE_SIMD 1
+#else
+#define PARTICLE_SIMD 0
+#endif
+
+static_assert(sizeof(Particle) == 12 * sizeof(float), "Particle üç vec4 olmalı (transform feedback çıktısı)");
+static_assert(sizeof(CubeInstance) == 8 * sizeof(float), "Particle'ın ilk iki vec4'ü CubeInstance ile eşleşmeli");
+
+const char* particleModeName(ParticleMode mode) {
+    switch (mode) {
+        case ParticleMode::Off: return "kapalı";
+        case ParticleMode::Points: return "nokta";
+        case ParticleMode::Cubes: return "küp";
+    }
+    return "?";
+}
+
+namespace {
+    // particle_update_vertex.glsl'deki hash() ile aynı
+    inline uint32_t hashParticle(uint32_t x) {
+        x ^= x >> 16;
+        x *= 0x7feb352du;
+        x ^= x >> 15;
+        x *= 0x846ca68bu;
+        x ^= x >> 16;
+        return x;
+    }
+
+    inline float random01(uint32_t& state) {
+        state = hashParticle(state);
+        return (float)(state >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // Adım boyunca sabit değerler - GPU'ya da aynı değerler uniform olarak gider
+    struct StepConstants {
+        float gravityStep[3];
+        float damping;
+    };
+
+    StepConstants stepConstants(const ParticleParams& params, float deltaTime) {
+        StepConstants constants;
+        for (int k = 0; k < 3; k++) {
+            constants.gravityStep[k] = params.gravity[k] * deltaTime;
+        }
+        constants.damping = std::max(0.0f, 1.0f - params.drag * deltaTime);
+        return constants;
+    }
+
+    // Yayıcıda yeniden doğma - rastgele sayılar shader ile aynı sırada çekilir; yeni ömrü döndürür
+    float spawnParticle(Particle& particle, uint32_t index, uint32_t seedHash, const ParticleParams& params) {
+        uint32_t state = hashParticle(index ^ seedHash);
+        float angle = random01(state) * 6.2831853f;
+        float radius = std::sqrt(random01(state)) * params.emitterRadius;
+        float direction = random01(state) * 6.2831853f;
+        float horizontal = random01(state) * params.spread;
+        float speed = params.speedMin + random01(state) * (params.speedMax - params.speedMin);
+        float life = params.lifetimeMin + random01(state) * (params.lifetimeMax - params.lifetimeMin);
+
+        particle.position[0] = params.emitterPosition[0] + std::cos(angle) * radius;
+        particle.position[1] = params.emitterPosition[1] + 0.0f;
+        particle.position[2] = params.emitterPosition[2] + std::sin(angle) * radius;
+        particle.velocity[0] = std::cos(direction) * horizontal;
+        particle.velocity[1] = speed;
+        particle.velocity[2] = std::sin(direction) * horizontal;
+        return life;
+    }
+
+    // Ömre bağlı boyut ve renk
+    inline void applyAppearance(Particle& particle, float life, const ParticleParams& params) {
+        float t = std::min(std::max(life / params.lifetimeMax, 0.0f), 1.0f);
+        particle.size = params.particleSize * (0.4f + 0.6f * t);
+        particle.color[0] = 1.0f;
+        particle.color[1] = 0.2f + 0.8f * t;
+        particle.color[2] = 0.05f + 0.6f * t * t;
+        particle.color[3] = 1.0f;
+        particle.life = life;
+    }
+
+    // İki durum arasındaki en büyük göreli farkı ve toleransı aşan parçacık sayısını bulur
+    void compareParticles(const std::vector<Particle>& expected, const std::vector<Particle>& actual,
+                          float& maxError, unsigned int& mismatches) {
+        const float tolerance = 1e-3f;
+        maxError = 0.0f;
+        mismatches = 0;
+        size_t count = std::min(expected.size(), actual.size());
+        for (size_t i = 0; i < count; i++) {
+            const float* a = expected[i].position;
+            const float* b = actual[i].position;
+            float worst = 0.0f;
+            for (int k = 0; k < 12; k++) {
+                worst = std::max(worst, std::fabs(a[k] - b[k]) / std::max(1.0f, std::fabs(a[k])));
+            }
+            maxError = std::max(maxError, worst);
+            if (worst > tolerance) {
+                mismatches++;
+            }
+        }
+        mismatches += static_cast<unsigned int>(std::max(expected.size(), actual.size()) - count);
+    }
+}
+
+std::vector<Particle> ParticleReference::generate(unsigned int count, const ParticleParams& params, unsigned int seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> ageFraction(0.0f, 1.0f);
+    uint32_t seedHash = hashParticle(seed);
+
+    // Her parçacık rastgele bir yaşta başlar; konum sürtünmesiz atış formülüyle yaklaşık hesaplanır
+    std::vector<Particle> particles(count);
+    for (unsigned int i = 0; i < count; i++) {
+        Particle& particle = particles[i];
+        float life = spawnParticle(particle, i, seedHash, params);
+        float age = ageFraction(rng) * life;
+        for (int k = 0; k < 3; k++) {
+            particle.position[k] += particle.velocity[k] * age + 0.5f * params.gravity[k] * age * age;
+            particle.velocity[k] += params.gravity[k] * age;
+        }
+        if (particle.position[1] < params.floorHeight) {
+            particle.position[1] = params.floorHeight;
+            particle.velocity[1] = 0.0f;
+        }
+        applyAppearance(particle, std::max(life - age, 1e-3f), params);
+    }
+    return particles;
+}
+
+void ParticleReference::stepScalar(Particle* particles, size_t begin, size_t end, const ParticleParams& params,
+                                   float deltaTime, uint32_t frameSeed) {
+    StepConstants constants = stepConstants(params, deltaTime);
+    uint32_t seedHash = hashParticle(frameSeed);
+
+    for (size_t i = begin; i < end; i++) {
+        Particle& particle = particles[i];
+        float life = particle.life - deltaTime;
+        if (life <= 0.0f) {
+            life = spawnParticle(particle, static_cast<uint32_t>(i), seedHash, params);
+        } else {
+            for (int k = 0; k < 3; k++) {
+                particle.velocity[k] = (particle.velocity[k] + constants.gravityStep[k]) * constants.damping;
+                particle.position[k] = particle.position[k] + particle.velocity[k] * deltaTime;
+            }
+            if (particle.position[1] < params.floorHeight) {
+                particle.position[1] = params.floorHeight;
+                particle.velocity[1] = -particle.velocity[1] * params.restitution;
+            }
+        }
+        applyAppearance(particle, life, params);
+    }
+}
+
+void ParticleReference::stepSimd(Particle* particles, size_t begin, size_t end, const ParticleParams& params,
+                                 float deltaTime, uint32_t frameSeed) {
+#if PARTICLE_SIMD
+    StepConstants constants = stepConstants(params, deltaTime);
+    uint32_t seedHash = hashParticle(frameSeed);
+
+    // (hız, ömür) + (yerçekimi adımı, -dt): ömür azaltma hız güncellemesiyle aynı toplamada yapılır
+    const __m128 velocityStep = _mm_set_ps(-deltaTime, constants.gravityStep[2], constants.gravityStep[1], constants.gravityStep[0]);
+    const __m128 dampingMask = _mm_set_ps(1.0f, constants.damping, constants.damping, constants.damping);
+    const __m128 timeMask = _mm_set_ps(0.0f, deltaTime, deltaTime, deltaTime);
+    const __m128 colorBase = _mm_set_ps(1.0f, 0.05f, 0.2f, 1.0f);
+
+    for (size_t i = begin; i < end; i++) {
+        Particle& particle = particles[i];
+        float* data = particle.position;
+
+        __m128 velocityLife = _mm_add_ps(_mm_loadu_ps(data + 8), velocityStep);
+        float life = _mm_cvtss_f32(_mm_shuffle_ps(velocityLife, velocityLife, _MM_SHUFFLE(3, 3, 3, 3)));
+        if (life <= 0.0f) {
+            life = spawnParticle(particle, static_cast<uint32_t>(i), seedHash, params);
+            applyAppearance(particle, life, params);
+            continue;
+        }
+
+        velocityLife = _mm_mul_ps(velocityLife, dampingMask);
+        __m128 positionSize = _mm_add_ps(_mm_loadu_ps(data), _mm_mul_ps(velocityLife, timeMask));
+
+        // Renk: (1, 0.2 + 0.8t, 0.05 + (0.6t)t, 1) - skaler yolla aynı işlem sırası
+        float t = std::min(std::max(life / params.lifetimeMax, 0.0f), 1.0f);
+        __m128 color = _mm_add_ps(colorBase, _mm_mul_ps(_mm_set_ps(0.0f, 0.6f * t, 0.8f, 0.0f), _mm_set1_ps(t)));
+
+        _mm_storeu_ps(data, positionSize);
+        _mm_storeu_ps(data + 4, color);
+        _mm_storeu_ps(data + 8, velocityLife);
+
+        if (particle.position[1] < params.floorHeight) {
+            particle.position[1] = params.floorHeight;
+            particle.velocity[1] = -particle.velocity[1] * params.restitution;
+        }
+        particle.size = params.particleSize * (0.4f + 0.6f * t);
+    }
+#else
+    stepScalar(particles, begin, end, params, deltaTime, frameSeed);
+#endif
+}
+
+void ParticleReference::step(std::vector<Particle>& particles, const ParticleParams& params, float deltaTime,
+                             uint32_t frameSeed, bool useSimd) {
+    Particle* data = particles.data();
+    Parallel::forRange(particles.size(), Parallel::workerCount(), [&](size_t begin, size_t end, unsigned int) {
+        if (useSimd) {
+            stepSimd(data, begin, end, params, deltaTime, frameSeed);
+        } else {
+            stepScalar(data, begin, end, params, deltaTime, frameSeed);
+        }
+    });
+}
+
+bool ParticleReference::simdAvailable() {
+    return PARTICLE_SIMD != 0;
+}
+
+bool ParticleSystem::init(const std::string& shaderDir, unsigned int cubeVBO, unsigned int cubeEBO) {
+    updateShader.reset(new Shader((shaderDir + "particle_update_vertex.glsl").c_str(), NULL, NULL,
+                                  { "outPositionSize", "outColor", "outVelocityLife" }));
+    pointShader.reset(new Shader((shaderDir + "particle_point_vertex.glsl").c_str(),
+                                 (shaderDir + "particle_point_fragment.glsl").c_str()));
+
+    glGenBuffers(2, buffers);
+    glGenVertexArrays(2, updateVAO);
+    glGenVertexArrays(2, cubeVAO);
+    glGenQueries(2, timeQueries);
+
+    for (int i = 0; i < 2; i++) {
+        // Simülasyon ve nokta çizimi girdisi: parçacık başına üç vec4
+        glBindVertexArray(updateVAO[i]);
+        glBindBuffer(GL_ARRAY_BUFFER, buffers[i]);
+        for (int attribute = 0; attribute < 3; attribute++) {
+            glVertexAttribPointer(attribute, 4, GL_FLOAT, GL_FALSE, sizeof(Particle), (void*)(attribute * 4 * sizeof(float)));
+            glEnableVertexAttribArray(attribute);
+        }
+
+        // Küp çizimi: paylaşılan küp geometrisi, parçacığın ilk iki vec4'ü örnek öznitelikleri
+        glBindVertexArray(cubeVAO[i]);
+        glBindBuffer(GL_ARRAY_BUFFER, cubeVBO);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, cubeEBO);
+        setCubeVertexAttributes();
+        glBindBuffer(GL_ARRAY_BUFFER, buffers[i]);
+        glVertexAttribPointer(INSTANCE_OFFSET_LOCATION, 4, GL_FLOAT, GL_FALSE, sizeof(Particle), (void*)0);
+        glEnableVertexAttribArray(INSTANCE_OFFSET_LOCATION);
+        glVertexAttribDivisor(INSTANCE_OFFSET_LOCATION, 1);
+        glVertexAttribPointer(INSTANCE_COLOR_LOCATION, 4, GL_FLOAT, GL_FALSE, sizeof(Particle), (void*)(4 * sizeof(float)));
+        glEnableVertexAttribArray(INSTANCE_COLOR_LOCATION);
+        glVertexAttribDivisor(INSTANCE_COLOR_LOCATION, 1);
+    }
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    return true;
+}
+
+void ParticleSystem::reset(unsigned int newCount, unsigned int seed) {
+    upload(ParticleReference::generate(newCount, params, seed));
+}
+
+void ParticleSystem::upload(const std::vector<Particle>& particles) {
+    count = static_cast<unsigned int>(particles.size());
+    for (int i = 0; i < 2; i++) {
+        glBindBuffer(GL_ARRAY_BUFFER, buffers[i]);
+        glBufferData(GL_ARRAY_BUFFER, particles.size() * sizeof(Particle), particles.data(), GL_DYNAMIC_COPY);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    current = 0;
+    frameSeed = 0;
+    queryPending[0] = queryPending[1] = false;
+}
+
+void ParticleSystem::update(float deltaTime) {
+    if (count == 0) {
+        return;
+    }
+
+    // İki adım önceki zaman sorgusu - bu noktada tamamlanmış olmalı
+    unsigned int slot = frameSeed % 2;
+    if (queryPending[slot]) {
+        GLuint64 elapsed = 0;
+        glGetQueryObjectui64v(timeQueries[slot], GL_QUERY_RESULT, &elapsed);
+        lastUpdateMs = (float)(elapsed / 1e6);
+    }
+
+    StepConstants constants = stepConstants(params, deltaTime);
+    updateShader->use();
+    updateShader->setFloat("deltaTime", deltaTime);
+    updateShader->setVec3("gravityStep", constants.gravityStep[0], constants.gravityStep[1], constants.gravityStep[2]);
+    updateShader->setFloat("damping", constants.damping);
+    updateShader->setInt("frameSeed", static_cast<int>(frameSeed));
+    updateShader->setVec3("emitterPosition", params.emitterPosition[0], params.emitterPosition[1], params.emitterPosition[2]);
+    updateShader->setFloat("emitterRadius", params.emitterRadius);
+    updateShader->setFloat("speedMin", params.speedMin);
+    updateShader->setFloat("speedMax", params.speedMax);
+    updateShader->setFloat("spread", params.spread);
+    updateShader->setFloat("lifetimeMin", params.lifetimeMin);
+    updateShader->setFloat("lifetimeMax", params.lifetimeMax);
+    updateShader->setFloat("floorHeight", params.floorHeight);
+    updateShader->setFloat("restitution", params.restitution);
+    updateShader->setFloat("particleSize", params.particleSize);
+
+    // Güncel tampondan oku, diğerine yaz
+    unsigned int target = 1 - current;
+    glEnable(GL_RASTERIZER_DISCARD);
+    glBindVertexArray(updateVAO[current]);
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, buffers[target]);
+    glBeginQuery(GL_TIME_ELAPSED, timeQueries[slot]);
+    glBeginTransformFeedback(GL_POINTS);
+    glDrawArrays(GL_POINTS, 0, count);
+    glEndTransformFeedback();
+    glEndQuery(GL_TIME_ELAPSED);
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0);
+    glDisable(GL_RASTERIZER_DISCARD);
+    glBindVertexArray(0);
+
+    queryPending[slot] = true;
+    current = target;
+    frameSeed++;
+}
+
+void ParticleSystem::drawPoints(const float* view, const float* projection) {
+    if (count == 0) {
+        return;
+    }
+    pointShader->use();
+    pointShader->setMat4("view", view);
+    pointShader->setMat4("projection", projection);
+    glPointSize(2.0f);
+    glBindVertexArray(updateVAO[current]);
+    glDrawArrays(GL_POINTS, 0, count);
+    glBindVertexArray(0);
+}
+
+void ParticleSystem::drawCubes() const {
+    if (count == 0) {
+        return;
+    }
+    glBindVertexArray(cubeVAO[current]);
+    glDrawElementsInstanced(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0, count);
+    glBindVertexArray(0);
+}
+
+void ParticleSystem::readback(std::vector<Particle>& out) const {
+    out.resize(count);
+    glBindBuffer(GL_ARRAY_BUFFER, buffers[current]);
+    glGetBufferSubData(GL_ARRAY_BUFFER, 0, count * sizeof(Particle), out.data());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void ParticleSystem::destroy() {
+    glDeleteBuffers(2, buffers);
+    glDeleteVertexArrays(2, updateVAO);
+    glDeleteVertexArrays(2, cubeVAO);
+    glDeleteQueries(2, timeQueries);
+    buffers[0] = buffers[1] = 0;
+    updateVAO[0] = updateVAO[1] = 0;
+    cubeVAO[0] = cubeVAO[1] = 0;
+    timeQueries[0] = timeQueries[1] = 0;
+    count = 0;
+    if (updateShader) {
+        updateShader->destroy();
+        updateShader.reset();
+    }
+    if (pointShader) {
+        pointShader->destroy();
+        pointShader.reset();
+    }
+}
+
+void runParticleBenchmark(ParticleSystem& particles) {
+    const int warmupSteps = 3;
+    const int measuredSteps = 20;
+    const float deltaTime = 1.0f / 60.0f;
+    const unsigned int particleCounts[] = { 65536, 262144, 1048576, 2097152 };
+
+    std::cout << "Parçacık simülasyonu (GPU: transform feedback, CPU: " << Parallel::workerCount()
+              << " iş parçacığı, " << measuredSteps << " adım ortalaması)" << std::endl;
+    if (!ParticleReference::simdAvailable()) {
+        std::cout << "Not: bu derlemede SSE yok, SSE sütunu skaler yolu ölçer" << std::endl;
+    }
+    std::cout << std::setw(10) << "parçacık" << std::setw(11) << "GPU (ms)" << std::setw(11) << "GPU M/s"
+              << std::setw(14) << "skaler (ms)" << std::setw(12) << "skaler M/s" << std::setw(11) << "SSE (ms)"
+              << std::setw(11) << "SSE M/s" << std::setw(12) << "GPU hata" << std::setw(12) << "uyuşmayan"
+              << std::setw(12) << "SSE hata" << std::endl;
+
+    for (unsigned int count : particleCounts) {
+        std::vector<Particle> initial = ParticleReference::generate(count, particles.params, 5u);
+
+        // Doğrulama - aynı başlangıç durumundan tek adım, GPU sonucu CPU referansıyla karşılaştırılır
+        particles.upload(initial);
+        particles.update(deltaTime);
+        std::vector<Particle> result;
+        particles.readback(result);
+
+        std::vector<Particle> reference = initial;
+        ParticleReference::step(reference, particles.params, deltaTime, 0, false);
+        float gpuError = 0.0f;
+        unsigned int gpuMismatches = 0;
+        compareParticles(reference, result, gpuError, gpuMismatches);
+
+        result = initial;
+        ParticleReference::step(result, particles.params, deltaTime, 0, true);
+        float simdError = 0.0f;
+        unsigned int simdMismatches = 0;
+        compareParticles(reference, result, simdError, simdMismatches);
+
+        // GPU süresi - adım başına zaman sorgusu (iki adım geriden okunur)
+        double gpuMs = 0.0;
+        for (int step = 0; step < warmupSteps + measuredSteps; step++) {
+            particles.update(deltaTime);
+            if (step >= warmupSteps) {
+                gpuMs += particles.lastUpdateMs;
+            }
+        }
+        glFinish();
+        gpuMs /= measuredSteps;
+
+        // CPU süresi - skaler ve SSE
+        double cpuMs[2] = { 0.0, 0.0 };
+        for (int mode = 0; mode < 2; mode++) {
+            std::vector<Particle>& state = mode == 0 ? reference : result;
+            for (int step = 0; step < warmupSteps + measuredSteps; step++) {
+                auto start = std::chrono::steady_clock::now();
+                ParticleReference::step(state, particles.params, deltaTime, static_cast<uint32_t>(step + 1), mode == 1);
+                auto stop = std::chrono::steady_clock::now();
+                if (step >= warmupSteps) {
+                    cpuMs[mode] += std::chrono::duration<double, std::milli>(stop - start).count();
+                }
+            }
+            cpuMs[mode] /= measuredSteps;
+        }
+
+        // Milyon parçacık / saniye
+        auto throughput = [count](double milliseconds) {
+            return milliseconds > 0.0 ? count / (milliseconds * 1000.0) : 0.0;
+        };
+        std::cout << std::setw(10) << count << std::fixed << std::setprecision(3)
+                  << std::setw(11) << gpuMs << std::setw(11) << std::setprecision(1) << throughput(gpuMs)
+                  << std::setw(14) << std::setprecision(3) << cpuMs[0] << std::setw(12) << std::setprecision(1) << throughput(cpuMs[0])
+                  << std::setw(11) << std::setprecision(3) << cpuMs[1] << std::setw(11) << std::setprecision(1) << throughput(cpuMs[1])
+                  << std::setw(12) << std::scientific << std::setprecision(1) << gpuError << std::setw(12) << gpuMismatches
+                  << std::setw(12) << simdError << std::endl;
+        std::cout.unsetf(std::ios::floatfield);
+    }
+}
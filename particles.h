@@ -0,0 +1,117 @@
+#ifndef PARTICLES_H
+#define PARTICLES_H
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "scene.h"
+#include "shader.h"
+
+// Parçacık - ilk iki vec4 CubeInstance ile aynı düzende, böylece parçacık tamponu
+// örneklenmiş küp çiziminde doğrudan örnek tamponu olarak kullanılabilir
+struct Particle {
+    float position[3]; // Dünya uzayındaki konum
+    float size;        // Küp ölçeği (ömürle küçülür)
+    float color[4];    // Renk (ömürle soğur) ve saydamlık
+    float velocity[3];
+    float life;        // Kalan ömür (saniye); sıfırın altına inince yayıcıdan yeniden doğar
+};
+
+// Parçacık çizim biçimi (G tuşu ile değiştirilir)
+enum class ParticleMode {
+    Off,    // Simülasyon ve çizim kapalı
+    Points, // Nokta olarak - milyonlarca parçacık için
+    Cubes   // Sahnenin shader'ıyla örneklenmiş küp olarak (gölge ve nokta ışıklar dahil)
+};
+
+const char* particleModeName(ParticleMode mode);
+
+// Çeşme yayıcısı ve hareket parametreleri - particle_update_vertex.glsl uniform'larıyla eşleşir
+struct ParticleParams {
+    float emitterPosition[3] = { 0.0f, 0.8f, 0.0f };
+    float emitterRadius = 0.15f;
+    float speedMin = 3.0f;       // Yukarı doğru başlangıç hızı
+    float speedMax = 6.0f;
+    float spread = 1.6f;         // Yatay hızın üst sınırı
+    float gravity[3] = { 0.0f, -4.0f, 0.0f };
+    float drag = 0.15f;          // Saniye başına hız kaybı oranı
+    float lifetimeMin = 2.0f;
+    float lifetimeMax = 5.0f;
+    float floorHeight = -2.0f;   // Parçacıkların sektiği görünmez zemin
+    float restitution = 0.45f;   // Sekmede korunan dikey hız oranı
+    float particleSize = 0.035f;
+};
+
+// CPU referans simülasyonu - GPU ile aynı adımı (aynı tamsayı özeti ile yeniden doğma dahil) uygular
+// Doğrulama ve parçacık/saniye karşılaştırması için; SSE yolu her parçacığın üç vec4'ünü birlikte işler
+namespace ParticleReference {
+    // Başlangıç durumu - ömürler dağıtılır, böylece parçacıklar aynı anda ölmez
+    std::vector<Particle> generate(unsigned int count, const ParticleParams& params, unsigned int seed);
+
+    // [begin, end) aralığını bir adım ilerletir; index yeniden doğma özetine girer
+    void stepScalar(Particle* particles, size_t begin, size_t end, const ParticleParams& params,
+                    float deltaTime, uint32_t frameSeed);
+    void stepSimd(Particle* particles, size_t begin, size_t end, const ParticleParams& params,
+                  float deltaTime, uint32_t frameSeed);
+
+    // Tüm parçacıkları iş parçacıklarına bölerek bir adım ilerletir
+    void step(std::vector<Particle>& particles, const ParticleParams& params, float deltaTime,
+              uint32_t frameSeed, bool useSimd);
+
+    // SSE yolunun bu derlemede olup olmadığı
+    bool simdAvailable();
+}
+
+// GPU parçacık sistemi - durum iki tampon arasında transform feedback ile gidip gelir (ping-pong);
+// simülasyon rasterizer kapalı bir vertex shader'da yapılır, CPU'ya veri dönmez
+class ParticleSystem {
+public:
+    ParticleParams params;
+    float lastUpdateMs = 0.0f; // Son okunabilen simülasyon adımının GPU süresi (zaman sorgusu)
+
+    bool init(const std::string& shaderDir, unsigned int cubeVBO, unsigned int cubeEBO);
+
+    // Parçacıkları yeniden oluşturur ve iki tampona da yükler
+    void reset(unsigned int count, unsigned int seed);
+
+    // Verilen durumu yükler (doğrulama için); adım sayacı sıfırlanır
+    void upload(const std::vector<Particle>& particles);
+
+    unsigned int particleCount() const { return count; }
+    uint32_t stepCount() const { return frameSeed; }
+
+    // Bir simülasyon adımı (transform feedback), ardından tamponlar yer değiştirir
+    void update(float deltaTime);
+
+    // Güncel durumu nokta olarak çizer
+    void drawPoints(const float* view, const float* projection);
+
+    // Güncel durumu sahnenin shader'ıyla örneklenmiş küp olarak çizer (shader bağlı ve ayarlı olmalı)
+    void drawCubes() const;
+
+    // Güncel durumu CPU'ya okur (yalnızca doğrulama için - boru hattını bekletir)
+    void readback(std::vector<Particle>& out) const;
+
+    void destroy();
+
+private:
+    std::unique_ptr<Shader> updateShader;
+    std::unique_ptr<Shader> pointShader;
+    unsigned int buffers[2] = { 0, 0 };
+    unsigned int updateVAO[2] = { 0, 0 }; // buffers[i]'yi simülasyon / nokta girdisi olarak okur
+    unsigned int cubeVAO[2] = { 0, 0 };   // Küp geometrisi + buffers[i] örnek öznitelikleri
+    unsigned int timeQueries[2] = { 0, 0 };
+    unsigned int current = 0;             // Güncel durumu tutan tampon
+    unsigned int count = 0;
+    uint32_t frameSeed = 0;
+    bool queryPending[2] = { false, false };
+};
+
+// Parçacık sayısına göre GPU, skaler CPU ve SSE CPU adım süresini ve parçacık/saniye değerini ölçer;
+// her sayıda GPU'nun tek adımı CPU referansıyla karşılaştırılır
+void runParticleBenchmark(ParticleSystem& particles);
+
+#endif // PARTICLES_H
@@ -0,0 +1,31 @@
+#ifndef RENDER_TARGET_H
+#define RENDER_TARGET_H
+
+#include <glad/glad.h>
+
+// Ekran dışı sahne hedefi - renk ve derinlik dokuları olan framebuffer
+// Derinlik dokusu diğer geçişlerle (ör. saydamlık birikimi) paylaşılabilir
+class RenderTarget {
+public:
+    unsigned int FBO = 0;
+    unsigned int colorTexture = 0; // RGBA8
+    unsigned int depthTexture = 0; // DEPTH_COMPONENT24
+    int width = 0;
+    int height = 0;
+
+    // Dokuları verilen boyutta (yeniden) oluşturur
+    bool create(int w, int h);
+
+    // Boyut değiştiyse dokuları yeniden oluşturur; değiştiyse true döner
+    bool resize(int w, int h);
+
+    // Framebuffer'ı bağlar ve viewport'u hedef boyutuna ayarlar
+    void bind() const;
+
+    // Renk içeriğini varsayılan framebuffer'a kopyalar (boyut farklıysa doğrusal süzgeçle ölçekler)
+    void blitToDefault(int targetWidth, int targetHeight) const;
+
+    void destroy();
+};
+
+#endif // RENDER_TARGET_H
@@ -0,0 +1,152 @@
+#include "scene.h"
+
+#include <cmath>
+#include <random>
+
+void setCubeVertexAttributes() {
+    const GLsizei stride = CUBE_VERTEX_FLOATS * sizeof(float);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, stride, (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(NORMAL_LOCATION, 3, GL_FLOAT, GL_FALSE, stride, (void*)(6 * sizeof(float)));
+    glEnableVertexAttribArray(NORMAL_LOCATION);
+    glVertexAttribPointer(TEXCOORD_LOCATION, 2, GL_FLOAT, GL_FALSE, stride, (void*)(9 * sizeof(float)));
+    glEnableVertexAttribArray(TEXCOORD_LOCATION);
+}
+
+void InstanceBatch::create(unsigned int cubeVBO, unsigned int cubeEBO) {
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &instanceVBO);
+
+    glBindVertexArray(VAO);
+
+    // Paylaşılan küp geometrisi (konum + renk + normal + doku koordinatı)
+    glBindBuffer(GL_ARRAY_BUFFER, cubeVBO);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, cubeEBO);
+    setCubeVertexAttributes();
+
+    // Örnek başına öznitelikler - her örnekte bir kez ilerler
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+    glVertexAttribPointer(INSTANCE_OFFSET_LOCATION, 4, GL_FLOAT, GL_FALSE, sizeof(CubeInstance), (void*)0);
+    glEnableVertexAttribArray(INSTANCE_OFFSET_LOCATION);
+    glVertexAttribDivisor(INSTANCE_OFFSET_LOCATION, 1);
+    glVertexAttribPointer(INSTANCE_COLOR_LOCATION, 4, GL_FLOAT, GL_FALSE, sizeof(CubeInstance), (void*)(4 * sizeof(float)));
+    glEnableVertexAttribArray(INSTANCE_COLOR_LOCATION);
+    glVertexAttribDivisor(INSTANCE_COLOR_LOCATION, 1);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void InstanceBatch::upload(const CubeInstance* instances, unsigned int instanceCount) {
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+    if (instanceCount > capacity) {
+        glBufferData(GL_ARRAY_BUFFER, instanceCount * sizeof(CubeInstance), instances, GL_DYNAMIC_DRAW);
+        capacity = instanceCount;
+    } else if (instanceCount > 0) {
+        // Tamponu yetim bırak (orphan) - sürücü önceki çizim bitene kadar beklemek zorunda kalmaz
+        glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(CubeInstance), NULL, GL_DYNAMIC_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, instanceCount * sizeof(CubeInstance), instances);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    count = instanceCount;
+}
+
+void InstanceBatch::draw() const {
+    if (count == 0) {
+        return;
+    }
+    glBindVertexArray(VAO);
+    glDrawElementsInstanced(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0, count);
+}
+
+void InstanceBatch::destroy() {
+    glDeleteVertexArrays(1, &VAO);
+    glDeleteBuffers(1, &instanceVBO);
+    VAO = instanceVBO = 0;
+    capacity = count = 0;
+}
+
+void setDefaultInstanceAttributes() {
+    // Konum (0,0,0), ölçek 1 ve beyaz, tamamen opak renk - tekil küp eski haliyle çizilir
+    glVertexAttrib4f(INSTANCE_OFFSET_LOCATION, 0.0f, 0.0f, 0.0f, 1.0f);
+    glVertexAttrib4f(INSTANCE_COLOR_LOCATION, 1.0f, 1.0f, 1.0f, 1.0f);
+}
+
+std::vector<CubeInstance> generateTransparentCubes(unsigned int count, float extent, unsigned int seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> position(-extent, extent);
+    std::uniform_real_distribution<float> scale(0.1f, 0.35f);
+    std::uniform_real_distribution<float> tint(0.3f, 1.0f);
+    std::uniform_real_distribution<float> alpha(0.15f, 0.6f);
+
+    std::vector<CubeInstance> instances(count);
+    for (CubeInstance& instance : instances) {
+        // Merkezdeki opak küpün içine düşen konumları yeniden seç
+        do {
+            instance.offset[0] = position(rng);
+            instance.offset[1] = position(rng);
+            instance.offset[2] = position(rng);
+        } while (extent > 1.0f &&
+                 instance.offset[0] * instance.offset[0] +
+                 instance.offset[1] * instance.offset[1] +
+                 instance.offset[2] * instance.offset[2] < 1.0f);
+
+        instance.scale = scale(rng);
+        instance.color[0] = tint(rng);
+        instance.color[1] = tint(rng);
+        instance.color[2] = tint(rng);
+        instance.color[3] = alpha(rng);
+    }
+    return instances;
+}
+
+std::vector<CubeInstance> generateOpaqueCubes(unsigned int count, float extent, unsigned int seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> horizontal(-extent, extent);
+    std::uniform_real_distribution<float> vertical(-extent * 0.25f, extent * 0.25f);
+    std::uniform_real_distribution<float> scale(0.3f, 0.9f);
+    std::uniform_real_distribution<float> tint(0.4f, 1.0f);
+
+    std::vector<CubeInstance> instances(count);
+    for (CubeInstance& instance : instances) {
+        // Merkezdeki küpün çevresini boş bırak
+        do {
+            instance.offset[0] = horizontal(rng);
+            instance.offset[1] = vertical(rng);
+            instance.offset[2] = horizontal(rng);
+        } while (instance.offset[0] * instance.offset[0] + instance.offset[2] * instance.offset[2] < 2.25f);
+
+        instance.scale = scale(rng);
+        instance.color[0] = tint(rng);
+        instance.color[1] = tint(rng);
+        instance.color[2] = tint(rng);
+        instance.color[3] = 1.0f;
+    }
+    return instances;
+}
+
+std::vector<CubeInstance> generateTexturedCubes(unsigned int count, float innerRadius, float outerRadius, unsigned int seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> jitter(-0.3f, 0.3f);
+    std::uniform_real_distribution<float> distance(innerRadius, outerRadius);
+    std::uniform_real_distribution<float> height(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> scale(0.5f, 1.0f);
+
+    std::vector<CubeInstance> instances(count);
+    for (unsigned int i = 0; i < count; i++) {
+        // Halka üzerinde eşit aralıklı, biraz kaydırılmış açılar
+        CubeInstance& instance = instances[i];
+        float angle = (i + 0.5f + jitter(rng)) * 6.2831853f / count;
+        float radius = distance(rng);
+        instance.offset[0] = std::cos(angle) * radius;
+        instance.offset[1] = height(rng);
+        instance.offset[2] = std::sin(angle) * radius;
+        instance.scale = scale(rng);
+
+        // Renk dokudan gelir - doku yüklenene kadar vertex rengi görünür
+        instance.color[0] = instance.color[1] = instance.color[2] = instance.color[3] = 1.0f;
+    }
+    return instances;
+}
@@ -0,0 +1,59 @@
+#ifndef SCENE_H
+#define SCENE_H
+
+#include <glad/glad.h>
+#include <vector>
+
+// Örneklenmiş (instanced) küp verisi - vertex shader'daki 2 ve 3 numaralı özniteliklerle eşleşir
+struct CubeInstance {
+    float offset[3]; // Dünya uzayındaki konum
+    float scale;     // Tekdüze ölçek
+    float color[4];  // Renk çarpanı (RGB) ve saydamlık (A)
+};
+
+// Örnek öznitelik konumları
+const unsigned int INSTANCE_OFFSET_LOCATION = 2;
+const unsigned int INSTANCE_COLOR_LOCATION = 3;
+
+// Küp vertex düzeni: konum (3), renk (3), normal (3), doku koordinatı (2)
+const unsigned int CUBE_VERTEX_FLOATS = 11;
+const unsigned int NORMAL_LOCATION = 4;
+const unsigned int TEXCOORD_LOCATION = 5;
+
+// Bağlı GL_ARRAY_BUFFER'daki küp geometrisi için konum, renk, normal ve doku koordinatı özniteliklerini ayarlar
+void setCubeVertexAttributes();
+
+// Aynı küp geometrisini paylaşan, kendi örnek tamponuna sahip çizim grubu
+class InstanceBatch {
+public:
+    unsigned int VAO = 0;         // Küp geometrisi + örnek öznitelikleri
+    unsigned int instanceVBO = 0; // CubeInstance dizisi
+    unsigned int capacity = 0;    // Tamponda yer ayrılmış örnek sayısı
+    unsigned int count = 0;       // Çizilecek örnek sayısı
+
+    // Küpün VBO/EBO'sunu paylaşan yeni bir VAO oluşturur
+    void create(unsigned int cubeVBO, unsigned int cubeEBO);
+
+    // Örnek verisini yükler; gerekirse tamponu büyütür, aksi halde üzerine yazar
+    void upload(const CubeInstance* instances, unsigned int instanceCount);
+
+    // Tüm örnekleri tek bir çağrıyla çizer
+    void draw() const;
+
+    void destroy();
+};
+
+// Örnek öznitelikleri kapalıyken kullanılacak sabit değerleri ayarlar (tekil küp çizimi için)
+void setDefaultInstanceAttributes();
+
+// Merkezdeki küpün etrafına dağılmış, birbiriyle örtüşen yarı saydam küpler üretir
+std::vector<CubeInstance> generateTransparentCubes(unsigned int count, float extent, unsigned int seed);
+
+// Kameranın yörüngesini de kapsayan geniş bir hacme dağılmış opak küpler üretir
+// Yakındaki küpler uzaktakileri örttüğünden yoğun overdraw ve oklüzyon oluşur
+std::vector<CubeInstance> generateOpaqueCubes(unsigned int count, float extent, unsigned int seed);
+
+// Merkezdeki küpün çevresinde bir halkaya dizilmiş, doku kaplanacak beyaz küpler üretir
+std::vector<CubeInstance> generateTexturedCubes(unsigned int count, float innerRadius, float outerRadius, unsigned int seed);
+
+#endif // SCENE_H
@@ -0,0 +1,176 @@
+#ifndef SHADER_H
+#define SHADER_H
+
+#include <glad/glad.h>
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Shader sınıfı - shader programını yükleme ve kullanma fonksiyonlarını içerir
+class Shader {
+public:
+    unsigned int ID; // Program ID
+    
+    // Constructor - shader dosyalarını okur ve derler
+    Shader(const char* vertexPath, const char* fragmentPath)
+        : Shader(vertexPath, fragmentPath, std::vector<std::string>()) {}
+    
+    // Constructor - geometry shader veya transform feedback çıktısı olan programlar için
+    // fragmentPath ve geometryPath NULL olabilir (ör. rasterizer kapalı transform feedback)
+    // feedbackVaryings boş değilse bağlamadan önce GL_INTERLEAVED_ATTRIBS ile kaydedilir
+    Shader(const char* vertexPath, const char* fragmentPath, const char* geometryPath,
+           const std::vector<const char*>& feedbackVaryings) {
+        unsigned int stages[3];
+        int stageCount = 0;
+        stages[stageCount++] = compileSource(GL_VERTEX_SHADER, readFile(vertexPath), "Vertex");
+        if (geometryPath != NULL)
+            stages[stageCount++] = compileSource(GL_GEOMETRY_SHADER, readFile(geometryPath), "Geometry");
+        if (fragmentPath != NULL)
+            stages[stageCount++] = compileSource(GL_FRAGMENT_SHADER, readFile(fragmentPath), "Fragment");
+        
+        ID = glCreateProgram();
+        for (int i = 0; i < stageCount; i++)
+            glAttachShader(ID, stages[i]);
+        
+        // Transform feedback çıktıları link öncesinde bildirilmeli
+        if (!feedbackVaryings.empty())
+            glTransformFeedbackVaryings(ID, (GLsizei)feedbackVaryings.size(), feedbackVaryings.data(), GL_INTERLEAVED_ATTRIBS);
+        
+        glLinkProgram(ID);
+        checkLinkStatus(ID);
+        
+        for (int i = 0; i < stageCount; i++)
+            glDeleteShader(stages[i]);
+    }
+    
+    // Constructor - tanımlar her aşamanın #version satırının ardına "#define AD" olarak eklenir
+    // (shader permütasyonları, bkz. shader_permutations.h)
+    Shader(const char* vertexPath, const char* fragmentPath, const std::vector<std::string>& defines) {
+        unsigned int vertex = compileSource(GL_VERTEX_SHADER, injectDefines(readFile(vertexPath), defines), "Vertex");
+        unsigned int fragment = compileSource(GL_FRAGMENT_SHADER, injectDefines(readFile(fragmentPath), defines), "Fragment");
+        
+        ID = glCreateProgram();
+        glAttachShader(ID, vertex);
+        glAttachShader(ID, fragment);
+        glLinkProgram(ID);
+        checkLinkStatus(ID);
+        
+        glDeleteShader(vertex);
+        glDeleteShader(fragment);
+    }
+    
+    // Başka yerde derlenip bağlanmış bir programı sarar (ör. toplu derlenen permütasyonlar)
+    explicit Shader(unsigned int programID) : ID(programID) {}
+    
+    // Dosyanın tüm içeriğini okur; okunamazsa boş string döner
+    static std::string readFile(const char* path) {
+        std::ifstream file(path);
+        if (!file) {
+            std::cerr << "HATA: Shader dosyası okunamadı: " << path << std::endl;
+            return std::string();
+        }
+        std::stringstream stream;
+        stream << file.rdbuf();
+        return stream.str();
+    }
+    
+    // Tek bir shader aşamasını kaynak koddan derler ve hataları yazdırır
+    static unsigned int compileSource(GLenum type, const std::string& code, const char* stageName) {
+        const char* source = code.c_str();
+        unsigned int shader = glCreateShader(type);
+        glShaderSource(shader, 1, &source, NULL);
+        glCompileShader(shader);
+        checkCompileStatus(shader, stageName);
+        return shader;
+    }
+    
+    // Derleme durumunu sorgular ve hatayı yazdırır - sürücü arka planda derliyorsa bitmesini bekler
+    static bool checkCompileStatus(unsigned int shader, const char* stageName) {
+        int success;
+        char infoLog[512];
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+        if (!success) {
+            glGetShaderInfoLog(shader, 512, NULL, infoLog);
+            std::cerr << "HATA: " << stageName << " shader derleme hatası\n" << infoLog << std::endl;
+        }
+        return success != 0;
+    }
+    
+    // Bağlama durumunu sorgular ve hatayı yazdırır
+    static bool checkLinkStatus(unsigned int program) {
+        int success;
+        char infoLog[512];
+        glGetProgramiv(program, GL_LINK_STATUS, &success);
+        if (!success) {
+            glGetProgramInfoLog(program, 512, NULL, infoLog);
+            std::cerr << "HATA: Shader programı bağlama hatası\n" << infoLog << std::endl;
+        }
+        return success != 0;
+    }
+    
+    // Tanımları #version satırından hemen sonra ekler (#version kaynaktaki ilk yönerge olmalı)
+    // Ardından gelen #line, derleyici hata mesajlarındaki satır numaralarını dosyayla eşleştirir
+    static std::string injectDefines(const std::string& code, const std::vector<std::string>& defines) {
+        if (defines.empty())
+            return code;
+        
+        size_t insertAt = 0;
+        size_t version = code.find("#version");
+        if (version != std::string::npos) {
+            size_t lineEnd = code.find('\n', version);
+            insertAt = lineEnd == std::string::npos ? code.size() : lineEnd + 1;
+        }
+        int nextLine = 1 + (int)std::count(code.begin(), code.begin() + insertAt, '\n');
+        
+        std::string block;
+        for (const std::string& define : defines)
+            block += "#define " + define + "\n";
+        block += "#line " + std::to_string(nextLine) + "\n";
+        return code.substr(0, insertAt) + block + code.substr(insertAt);
+    }
+    
+    // Programı siler - sınıfın yıkıcısı yok, sahibi olan modülün destroy() fonksiyonu çağırır
+    void destroy() {
+        glDeleteProgram(ID);
+        ID = 0;
+    }
+    
+    // Programı aktif et
+    void use() {
+        glUseProgram(ID);
+    }
+    
+    // Uniform değişkenlerini ayarla
+    void setBool(const std::string &name, bool value) const {
+        glUniform1i(glGetUniformLocation(ID, name.c_str()), (int)value);
+    }
+    
+    void setInt(const std::string &name, int value) const {
+        glUniform1i(glGetUniformLocation(ID, name.c_str()), value);
+    }
+    
+    void setFloat(const std::string &name, float value) const {
+        glUniform1f(glGetUniformLocation(ID, name.c_str()), value);
+    }
+    
+    void setVec2(const std::string &name, float x, float y) const {
+        glUniform2f(glGetUniformLocation(ID, name.c_str()), x, y);
+    }
+    
+    void setIVec2(const std::string &name, int x, int y) const {
+        glUniform2i(glGetUniformLocation(ID, name.c_str()), x, y);
+    }
+    
+    void setVec3(const std::string &name, float x, float y, float z) const {
+        glUniform3f(glGetUniformLocation(ID, name.c_str()), x, y, z);
+    }
+    
+    void setMat4(const std::string &name, const float* mat) const {
+        glUniformMatrix4fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, mat);
+    }
+};
+
+#endif // SHADER_H
@@ -0,0 +1,184 @@
+#include "shader_permutations.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+namespace {
+
+const char* const FEATURE_DEFINES[ShaderFeature::Count] = {
+    "INSTANCING", "LIGHTING", "SHADOWS", "CLUSTERED_LIGHTS",
+    "ALBEDO_TEXTURE", "DEBUG_NORMALS", "DEBUG_POSITION", "DEBUG_SCREEN"
+};
+
+// Sürücü destekliyorsa derlemeyi arka plan iş parçacıklarına açar (context başına bir kez yeter)
+void enableParallelCompile() {
+    static bool enabled = false;
+    if (enabled) {
+        return;
+    }
+    enabled = true;
+
+    GLint extensionCount = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+    for (GLint i = 0; i < extensionCount; i++) {
+        const char* name = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+        if (name == NULL) {
+            continue;
+        }
+        // 0xFFFFFFFF: sürücünün seçtiği en fazla iş parçacığı
+        if (std::strcmp(name, "GL_KHR_parallel_shader_compile") == 0 && glMaxShaderCompilerThreadsKHR != NULL) {
+            glMaxShaderCompilerThreadsKHR(0xFFFFFFFFu);
+            return;
+        }
+        if (std::strcmp(name, "GL_ARB_parallel_shader_compile") == 0 && glMaxShaderCompilerThreadsARB != NULL) {
+            glMaxShaderCompilerThreadsARB(0xFFFFFFFFu);
+            return;
+        }
+    }
+}
+
+// Derlemeyi başlatır, durumu sorgulamaz
+unsigned int submitStage(GLenum type, const std::string& code) {
+    const char* source = code.c_str();
+    unsigned int shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+    return shader;
+}
+
+} // namespace
+
+std::vector<std::string> shaderFeatureDefines(uint32_t features) {
+    std::vector<std::string> defines;
+    for (unsigned int bit = 0; bit < ShaderFeature::Count; bit++) {
+        if (features & (1u << bit)) {
+            defines.push_back(FEATURE_DEFINES[bit]);
+        }
+    }
+    return defines;
+}
+
+std::string shaderFeatureName(uint32_t features) {
+    std::string name;
+    for (const std::string& define : shaderFeatureDefines(features)) {
+        name += name.empty() ? define : "|" + define;
+    }
+    return name.empty() ? "TEMEL" : name;
+}
+
+bool ShaderPermutations::init(const std::string& vertexPath, const std::string& fragmentPath,
+                              std::function<void(Shader&)> setupProgram) {
+    vertexSource = Shader::readFile(vertexPath.c_str());
+    fragmentSource = Shader::readFile(fragmentPath.c_str());
+    setup = setupProgram;
+    enableParallelCompile();
+    return !vertexSource.empty() && !fragmentSource.empty();
+}
+
+Shader& ShaderPermutations::get(uint32_t features) {
+    auto it = cache.find(features);
+    if (it != cache.end()) {
+        return *it->second;
+    }
+
+    // Geçersiz birleşim derlenmez - maskeyi derleme zamanında denetlenen tablolardan almak çağıranın işi
+    if (!validShaderFeatures(features)) {
+        std::cerr << "HATA: Geçersiz shader özellik birleşimi derlenmedi: " << shaderFeatureName(features)
+                  << " (temel permütasyon kullanılıyor)" << std::endl;
+        return get(0);
+    }
+
+    // İlk kullanımda derleme - bu kare takılabilir, sık kullanılanlar precompile() ile verilmeli
+    if (failed.count(features) == 0) {
+        double before = compileMs;
+        precompile({ features });
+        lazyCompiles++;
+        auto compiled = cache.find(features);
+        if (compiled != cache.end()) {
+            std::cout << "Shader permütasyonu derlendi: " << shaderFeatureName(features)
+                      << " (" << (compileMs - before) << " ms)" << std::endl;
+            return *compiled->second;
+        }
+    }
+
+    // Derlenemedi - temel permütasyona düşülür; o da derlenemediyse program 0 (çizimler GL hatası verir)
+    return features == 0 ? unavailable : get(0);
+}
+
+void ShaderPermutations::precompile(const std::vector<uint32_t>& featureSets) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    struct Pending {
+        uint32_t features;
+        unsigned int vertex;
+        unsigned int fragment;
+        unsigned int program;
+    };
+    std::vector<Pending> pending;
+
+    // 1. Tüm aşamaları derlemeye gönder
+    for (uint32_t features : featureSets) {
+        bool queued = std::any_of(pending.begin(), pending.end(),
+                                  [features](const Pending& p) { return p.features == features; });
+        if (queued || cache.count(features) || failed.count(features)) {
+            continue;
+        }
+        if (!validShaderFeatures(features)) {
+            std::cerr << "HATA: Geçersiz shader özellik birleşimi derlenmedi: " << shaderFeatureName(features) << std::endl;
+            continue;
+        }
+
+        std::vector<std::string> defines = shaderFeatureDefines(features);
+        Pending p;
+        p.features = features;
+        p.vertex = submitStage(GL_VERTEX_SHADER, Shader::injectDefines(vertexSource, defines));
+        p.fragment = submitStage(GL_FRAGMENT_SHADER, Shader::injectDefines(fragmentSource, defines));
+        p.program = 0;
+        pending.push_back(p);
+    }
+
+    // 2. Tüm programları bağlamaya gönder
+    for (Pending& p : pending) {
+        p.program = glCreateProgram();
+        glAttachShader(p.program, p.vertex);
+        glAttachShader(p.program, p.fragment);
+        glLinkProgram(p.program);
+    }
+
+    // 3. Durumları şimdi sorgula - ilk sorgu gerekirse o programın bitmesini bekler
+    for (const Pending& p : pending) {
+        bool vertexOk = Shader::checkCompileStatus(p.vertex, "Vertex");
+        bool fragmentOk = Shader::checkCompileStatus(p.fragment, "Fragment");
+        bool linked = vertexOk && fragmentOk && Shader::checkLinkStatus(p.program);
+        glDeleteShader(p.vertex);
+        glDeleteShader(p.fragment);
+
+        // Bozuk program önbelleğe alınmaz - get() temel permütasyona düşer
+        if (!linked) {
+            std::cerr << "HATA: Shader permütasyonu derlenemedi: " << shaderFeatureName(p.features)
+                      << (p.features != 0 ? " (temel permütasyon kullanılacak)" : "") << std::endl;
+            glDeleteProgram(p.program);
+            failed.insert(p.features);
+            continue;
+        }
+
+        Shader* shader = new Shader(p.program);
+        cache[p.features].reset(shader);
+        if (setup) {
+            setup(*shader);
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    compileMs += std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void ShaderPermutations::destroy() {
+    for (auto& entry : cache) {
+        entry.second->destroy();
+    }
+    cache.clear();
+    failed.clear();
+}
@@ -0,0 +1,87 @@
+#ifndef SHADER_PERMUTATIONS_H
+#define SHADER_PERMUTATIONS_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "shader.h"
+
+// vertex.glsl / fragment.glsl özellik bayrakları - her açık bayrak kaynağa #define olarak eklenir,
+// kapalı özellikler programa hiç derlenmez (shader'da uniform'a bağlı dallanma yok)
+namespace ShaderFeature {
+    constexpr uint32_t Instancing      = 1u << 0; // INSTANCING - örnek başına konum/ölçek ve renk
+    constexpr uint32_t Lighting        = 1u << 1; // LIGHTING - yönlü Blinn-Phong ışık
+    constexpr uint32_t Shadows         = 1u << 2; // SHADOWS - kademeli gölge haritaları
+    constexpr uint32_t ClusteredLights = 1u << 3; // CLUSTERED_LIGHTS - kümelenmiş nokta ışıklar
+    constexpr uint32_t AlbedoTexture   = 1u << 4; // ALBEDO_TEXTURE - temel renk dokudan
+    constexpr uint32_t DebugNormals    = 1u << 5; // DEBUG_NORMALS - normal renk olarak
+    constexpr uint32_t DebugPosition   = 1u << 6; // DEBUG_POSITION - yerel konum renk olarak
+    constexpr uint32_t DebugScreen     = 1u << 7; // DEBUG_SCREEN - ekran koordinatları renk olarak
+
+    constexpr unsigned int Count = 8;
+    constexpr uint32_t All = (1u << Count) - 1;
+    constexpr uint32_t DebugViews = DebugNormals | DebugPosition | DebugScreen;
+}
+
+// Geçerli birleşim: bilinmeyen bit yok, en fazla bir hata ayıklama görünümü,
+// gölge ve nokta ışıklar yalnızca yönlü ışıkla birlikte
+constexpr bool validShaderFeatures(uint32_t features) {
+    return (features & ~ShaderFeature::All) == 0 &&
+           ((features & ShaderFeature::DebugViews) & ((features & ShaderFeature::DebugViews) - 1)) == 0 &&
+           ((features & (ShaderFeature::Shadows | ShaderFeature::ClusteredLights)) == 0 ||
+            (features & ShaderFeature::Lighting) != 0);
+}
+
+// Açık bayrakların #define adları (bit sırasıyla)
+std::vector<std::string> shaderFeatureDefines(uint32_t features);
+
+// Günlük için ad, ör. "INSTANCING|LIGHTING"; boş maske "TEMEL"
+std::string shaderFeatureName(uint32_t features);
+
+// Aynı vertex/fragment kaynağından özellik maskesine göre üretilen programlar.
+// Her permütasyon ilk istendiğinde derlenip önbelleğe alınır; sık kullanılanlar
+// precompile() ile baştan toplu derlenebilir
+class ShaderPermutations {
+public:
+    double compileMs = 0.0;         // Toplam derleme + bağlama süresi (CPU tarafı, sürücü beklemesi dahil)
+    unsigned int lazyCompiles = 0;  // Çizim sırasında derlenmek zorunda kalınan permütasyonlar
+
+    // Kaynaklar bir kez okunur; setup her yeni programa bir kez uygulanır (ör. örnekleyici birimleri)
+    bool init(const std::string& vertexPath, const std::string& fragmentPath,
+              std::function<void(Shader&)> setup = nullptr);
+
+    // Permütasyonu döndürür; önbellekte yoksa şimdi derler. Geçersiz maske derlenmez, derlenemeyen
+    // permütasyon önbelleğe alınmaz ve yeniden denenmez - ikisinde de temel (0) permütasyon döner
+    Shader& get(uint32_t features);
+
+    // Maske derleme zamanında biliniyorsa geçerliliği de derleme zamanında denetlenir
+    template <uint32_t Features>
+    Shader& get() {
+        static_assert(validShaderFeatures(Features), "Geçersiz shader özellik birleşimi");
+        return get(Features);
+    }
+
+    // Permütasyonları toplu derler; geçersiz maskeler atlanır, derlenemeyen programlar silinir.
+    // Tüm derleme ve bağlama komutları durum sorgulanmadan gönderilir, böylece paralel derleme yapan
+    // sürücüler (KHR_parallel_shader_compile) bunları aynı anda işler
+    void precompile(const std::vector<uint32_t>& featureSets);
+
+    size_t cachedCount() const { return cache.size(); }
+
+    void destroy();
+
+private:
+    std::string vertexSource;
+    std::string fragmentSource;
+    std::function<void(Shader&)> setup;
+    std::unordered_map<uint32_t, std::unique_ptr<Shader>> cache;
+    std::unordered_set<uint32_t> failed; // Derlenemeyen maskeler
+    Shader unavailable{ 0u };            // Temel permütasyon da derlenemediyse (program 0)
+};
+
+#endif // SHADER_PERMUTATIONS_H
@@ -0,0 +1,22 @@
+#version 330 core
+
+// Yalnızca görünür örnekleri transform feedback tamponuna yazar (akış sıkıştırma)
+
+layout (points) in;
+layout (points, max_vertices = 1) out;
+
+in vec4 instanceOffset[];
+in vec4 instanceColor[];
+flat in int instanceVisible[];
+
+out vec4 outOffset;
+out vec4 outColor;
+
+void main() {
+    if (instanceVisible[0] != 0) {
+        outOffset = instanceOffset[0];
+        outColor = instanceColor[0];
+        EmitVertex();
+        EndPrimitive();
+    }
+}
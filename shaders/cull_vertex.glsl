@@ -0,0 +1,73 @@
+#version 330 core
+
+// Örnek başına görünürlük testi (transform feedback ile, rasterizer kapalı)
+// Her nokta bir küp örneğidir; sınır kutusu Hi-Z piramidine karşı test edilir
+
+layout (location = 0) in vec4 aInstanceOffset; // Konum (xyz) ve ölçek (w)
+layout (location = 1) in vec4 aInstanceColor;
+
+out vec4 instanceOffset;
+out vec4 instanceColor;
+flat out int instanceVisible;
+
+uniform mat4 viewProjection; // Hi-Z piramidinin çizildiği görünüm-projeksiyon matrisi
+uniform sampler2D hiZ;       // Hi-Z piramidi (R32F, mip seviyeleri)
+uniform vec2 hiZSize;        // 0. seviyenin boyutu
+uniform int hiZLevels;
+
+bool isVisible() {
+    vec3 center = aInstanceOffset.xyz;
+    vec3 halfSize = vec3(0.5 * aInstanceOffset.w); // Birim küp: ±0.5
+    
+    vec2 minNdc = vec2(1.0);
+    vec2 maxNdc = vec2(-1.0);
+    float minDepth = 1.0;
+    
+    // Kutunun 8 köşesini ekrana yansıt
+    for (int i = 0; i < 8; i++) {
+        vec3 corner = center + halfSize * vec3((i & 1) != 0 ? 1.0 : -1.0,
+                                               (i & 2) != 0 ? 1.0 : -1.0,
+                                               (i & 4) != 0 ? 1.0 : -1.0);
+        vec4 clip = viewProjection * vec4(corner, 1.0);
+        
+        // Yakın düzlemi kesen kutular için güvenilir bir ekran dikdörtgeni yok - görünür say
+        if (clip.w <= 1e-4)
+            return true;
+        
+        vec3 ndc = clip.xyz / clip.w;
+        minNdc = min(minNdc, ndc.xy);
+        maxNdc = max(maxNdc, ndc.xy);
+        minDepth = min(minDepth, ndc.z * 0.5 + 0.5);
+    }
+    
+    // Görüş hacminin dışında
+    if (any(lessThan(maxNdc, vec2(-1.0))) || any(greaterThan(minNdc, vec2(1.0))) || minDepth > 1.0)
+        return false;
+    
+    // Kapsanan piksel dikdörtgeni (0. seviye)
+    ivec2 size = ivec2(hiZSize);
+    ivec2 minPixel = clamp(ivec2((minNdc * 0.5 + 0.5) * hiZSize), ivec2(0), size - 1);
+    ivec2 maxPixel = clamp(ivec2((maxNdc * 0.5 + 0.5) * hiZSize), ivec2(0), size - 1);
+    
+    // Dikdörtgeni en fazla 2x2 texel kaplayacak seviyeyi seç
+    ivec2 extent = maxPixel - minPixel + 1;
+    int level = int(ceil(log2(float(max(extent.x, extent.y)))));
+    level = clamp(level, 0, hiZLevels - 1);
+    
+    // Tek boyutlu seviyelerde artan satır/sütun son texel'e katlandığından sınırla
+    ivec2 levelSize = textureSize(hiZ, level);
+    ivec2 minTexel = min(minPixel >> level, levelSize - 1);
+    ivec2 maxTexel = min(maxPixel >> level, levelSize - 1);
+    
+    float maxDepth = max(max(texelFetch(hiZ, minTexel, level).r, texelFetch(hiZ, ivec2(maxTexel.x, minTexel.y), level).r),
+                         max(texelFetch(hiZ, ivec2(minTexel.x, maxTexel.y), level).r, texelFetch(hiZ, maxTexel, level).r));
+    
+    // Kutunun en yakın noktası, kapladığı bölgedeki en uzak örtücüden de uzaksa gizlidir
+    return minDepth <= maxDepth;
+}
+
+void main() {
+    instanceOffset = aInstanceOffset;
+    instanceColor = aInstanceColor;
+    instanceVisible = isVisible() ? 1 : 0;
+}
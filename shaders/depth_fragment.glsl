@@ -0,0 +1,5 @@
+#version 330 core
+
+// Derinlik ön geçişi - renk yazılmaz, yalnızca derinlik tamponu doldurulur
+void main() {
+}
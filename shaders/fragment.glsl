@@ -1,31 +1,179 @@
 #version 330 core
 
+// Özellik bayrakları C++ tarafında #version satırının ardına #define olarak eklenir (shader_permutations.h);
+// kapalı özellikler programa hiç derlenmez:
+//   LIGHTING         - yönlü Blinn-Phong ışık (yoksa yalnızca ortam ışığı)
+//   SHADOWS          - kademeli gölge haritaları (LIGHTING ile)
+//   CLUSTERED_LIGHTS - kümelenmiş nokta ışıklar (LIGHTING ile)
+//   ALBEDO_TEXTURE   - temel renk dokudan (yoksa vertex rengi)
+//   DEBUG_NORMALS    - dünya uzayı normali renk olarak
+//   DEBUG_SCREEN     - normalize ekran koordinatları renk olarak
+
 // Vertex shader'dan gelen veriler
 in vec3 vertexColor;  // Vertex shader'dan gelen renk bilgisi
+in float vertexAlpha; // Vertex shader'dan gelen saydamlık (opak çizimlerde 1.0)
+in vec3 worldPosition; // Dünya uzayındaki konum
+in vec3 worldNormal;   // Dünya uzayındaki normal
+in float viewDepth;    // Kameraya olan derinlik
+in vec2 texCoord;      // Doku koordinatı
 
 // Çıkış değişkeni (frame buffer'a yazılacak piksel rengi)
 out vec4 FragColor;
 
 // Uniform değişkenler
 uniform float ambientStrength = 0.3; // Ortam ışık şiddeti
+uniform vec2 viewportSize = vec2(800.0, 600.0); // DEBUG_SCREEN için hedef boyutu
+
+#ifdef LIGHTING
+// Yönlü ışık (Blinn-Phong)
+uniform vec3 lightDirection = vec3(-0.4, -0.8, -0.3); // Işığın ilerleme yönü (ışıktan sahneye)
+uniform vec3 lightColor = vec3(1.0);
+uniform vec3 viewPosition;              // Kameranın dünya uzayındaki konumu
+uniform float specularStrength = 0.35;
+uniform float shininess = 32.0;
+#endif
+
+#ifdef ALBEDO_TEXTURE
+// Renk dokusu
+uniform sampler2D albedoTexture;
+#endif
+
+#ifdef SHADOWS
+// Kademeli gölge haritaları - cascadeCount 0 ise gölge yok
+const int MAX_CASCADES = 4;
+uniform sampler2DArrayShadow shadowMap;
+uniform int cascadeCount = 0;
+uniform float cascadeSplits[MAX_CASCADES];         // Kademelerin uzak sınırları (görünüm uzayı derinliği)
+uniform mat4 lightViewProjections[MAX_CASCADES];   // Kademe başına ışık görünüm-projeksiyonu
+uniform float normalOffset[MAX_CASCADES];          // Kademe başına normal yönünde kaydırma (bir texel)
+#endif
+
+#ifdef CLUSTERED_LIGHTS
+// Kümelenmiş nokta ışıkları - kamera kesik piramidi CLUSTER_GRID kümesine bölünür;
+// her küme yalnızca kendisine değen ışıkların listesini tutar
+const ivec3 CLUSTER_GRID = ivec3(16, 9, 24);     // clustered_lights.h ile eşleşir
+uniform usamplerBuffer clusterGrid;    // Küme başına (başlangıç, sayı)
+uniform usamplerBuffer lightIndices;   // Birleşik ışık indeks listesi
+uniform samplerBuffer lightData;       // Işık başına 2 texel: (konum, yarıçap), (renk * şiddet)
+uniform vec2 clusterTileSize;          // Bir kümenin piksel boyutu
+uniform float clusterDepthScale;       // Z dilimi = log(derinlik) * ölçek + kaydırma
+uniform float clusterDepthBias;
+#endif
+
+#ifdef SHADOWS
+// 0: tamamen gölgede, 1: tamamen aydınlık
+float shadowFactor(vec3 normal) {
+    if (cascadeCount == 0 || viewDepth > cascadeSplits[cascadeCount - 1]) {
+        return 1.0;
+    }
+
+    // Derinliği kapsayan ilk kademe
+    int cascade = cascadeCount - 1;
+    for (int i = 0; i < cascadeCount; i++) {
+        if (viewDepth <= cascadeSplits[i]) {
+            cascade = i;
+            break;
+        }
+    }
+
+    // Normal yönünde kaydırma gölge lekelenmesini (acne) büyük ölçüde giderir
+    vec4 lightSpace = lightViewProjections[cascade] * vec4(worldPosition + normal * normalOffset[cascade], 1.0);
+    vec3 coord = lightSpace.xyz / lightSpace.w * 0.5 + 0.5;
+    if (coord.z > 1.0) {
+        return 1.0;
+    }
+
+    // 2x2 PCF - karşılaştırmalı örnekleme her dokunuşta donanım 2x2 süzmesi yapar
+    vec2 texel = 1.0 / vec2(textureSize(shadowMap, 0).xy);
+    float lit = 0.0;
+    for (int y = 0; y < 2; y++) {
+        for (int x = 0; x < 2; x++) {
+            vec2 offset = (vec2(x, y) - 0.5) * texel;
+            lit += texture(shadowMap, vec4(coord.xy + offset, float(cascade), coord.z));
+        }
+    }
+    return lit * 0.25;
+}
+#endif
+
+#ifdef CLUSTERED_LIGHTS
+// Parçanın kümesindeki nokta ışıkların Blinn-Phong katkısı
+vec3 pointLighting(vec3 baseColor, vec3 N, vec3 V) {
+    ivec2 tile = clamp(ivec2(gl_FragCoord.xy / clusterTileSize), ivec2(0), CLUSTER_GRID.xy - 1);
+    int slice = clamp(int(floor(log(viewDepth) * clusterDepthScale + clusterDepthBias)), 0, CLUSTER_GRID.z - 1);
+    int cluster = (slice * CLUSTER_GRID.y + tile.y) * CLUSTER_GRID.x + tile.x;
+    uvec2 range = texelFetch(clusterGrid, cluster).rg;
+
+    vec3 result = vec3(0.0);
+    for (uint i = 0u; i < range.y; i++) {
+        int light = int(texelFetch(lightIndices, int(range.x + i)).r);
+        vec4 positionRadius = texelFetch(lightData, light * 2);
+        vec3 color = texelFetch(lightData, light * 2 + 1).rgb;
+
+        vec3 toLight = positionRadius.xyz - worldPosition;
+        float distance = length(toLight);
+        if (distance >= positionRadius.w) {
+            continue;
+        }
+
+        // Yarıçapta sıfıra inen yumuşak zayıflama
+        float falloff = 1.0 - (distance * distance) / (positionRadius.w * positionRadius.w);
+        falloff *= falloff;
+
+        vec3 L = toLight / distance;
+        vec3 H = normalize(L + V);
+        float diffuse = max(dot(N, L), 0.0);
+        float specular = diffuse > 0.0 ? pow(max(dot(N, H), 0.0), shininess) * specularStrength : 0.0;
+        result += (baseColor * diffuse + vec3(specular)) * color * falloff;
+    }
+    return result;
+}
+
+#endif
 
 void main() {
-    // Temel renk hesaplaması - vertex shader'dan gelen renkle doğrudan boyama
+#if defined(DEBUG_NORMALS)
+    // Hata ayıklama: dünya uzayı normali [0, 1] aralığında
+    FragColor = vec4(normalize(worldNormal) * 0.5 + 0.5, vertexAlpha);
+#elif defined(DEBUG_SCREEN)
+    // Hata ayıklama: normalize ekran koordinatları
+    FragColor = vec4(gl_FragCoord.xy / viewportSize, 0.0, vertexAlpha);
+#else
+    // Temel renk hesaplaması - doku ya da vertex shader'dan gelen renk
+#ifdef ALBEDO_TEXTURE
+    vec3 baseColor = texture(albedoTexture, texCoord).rgb;
+#else
     vec3 baseColor = vertexColor;
-    
+#endif
+
     // Basit ortam ışığı (ambient light) hesaplaması
-    // Gerçek bir sahne için directional light, point light, veya spotlight eklenebilir
     vec3 ambientColor = ambientStrength * baseColor;
-    
-    // Basit sahte aydınlatma (fake lighting) hesaplaması
-    // Gerçek bir uygulama için normal vektörleri ve ışık yönü kullanılır
-    
-    // Aydınlatma olmadan doğrudan vertex rengi kullanımı
-    // FragColor = vec4(baseColor, 1.0);
-    
-    // Basit ortam ışığı ile renklendirme
-    FragColor = vec4(ambientColor + baseColor * (1.0 - ambientStrength), 1.0);
-    
-    // Alternatif: Ekrana normalize edilmiş koordinatları göstermek için
-    // FragColor = vec4(gl_FragCoord.x / 800.0, gl_FragCoord.y / 600.0, 0.0, 1.0);
-}
\ No newline at end of file
+
+#ifdef LIGHTING
+    // Yönlü ışık - Blinn-Phong yaygın ve yansıyan bileşenleri
+    vec3 N = normalize(worldNormal);
+    vec3 L = normalize(-lightDirection);
+    vec3 V = normalize(viewPosition - worldPosition);
+    vec3 H = normalize(L + V);
+    float diffuse = max(dot(N, L), 0.0);
+    float specular = diffuse > 0.0 ? pow(max(dot(N, H), 0.0), shininess) * specularStrength : 0.0;
+
+    // Gölge yalnızca doğrudan ışığı etkiler; ortam ışığı değişmez
+#ifdef SHADOWS
+    float shadow = diffuse > 0.0 ? shadowFactor(N) : 1.0;
+#else
+    float shadow = 1.0;
+#endif
+    vec3 directColor = (baseColor * (1.0 - ambientStrength) * diffuse + vec3(specular)) * lightColor * shadow;
+#ifdef CLUSTERED_LIGHTS
+    directColor += pointLighting(baseColor, N, V);
+#endif
+#else
+    // Aydınlatmasız: ortam ışığının kalanı doğrudan temel renk
+    vec3 directColor = (1.0 - ambientStrength) * baseColor;
+#endif
+
+    // Sıralı saydamlık modunda alfa karıştırma için vertexAlpha
+    FragColor = vec4(ambientColor + directColor, vertexAlpha);
+#endif
+}
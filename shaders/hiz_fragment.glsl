@@ -0,0 +1,41 @@
+#version 330 core
+
+// Hiyerarşik Z (Hi-Z) piramidi oluşturma
+// downsample kapalıyken derinlik dokusu 0. seviyeye kopyalanır; açıkken bir önceki
+// seviyenin 2x2 bloğunun en büyük (en uzak) derinliği alınır. Tek boyutlu seviyelerde
+// son satır/sütun da dahil edilir, böylece piramit her zaman ihtiyatlı kalır.
+
+out float hiZDepth;
+
+uniform sampler2D source;  // Derinlik dokusu ya da bir önceki Hi-Z seviyesi (taban seviye olarak)
+uniform ivec2 sourceSize;  // Kaynak seviyenin boyutu
+uniform bool downsample;
+
+float fetchDepth(ivec2 coord) {
+    return texelFetch(source, min(coord, sourceSize - 1), 0).r;
+}
+
+void main() {
+    ivec2 coord = ivec2(gl_FragCoord.xy);
+    
+    if (!downsample) {
+        hiZDepth = fetchDepth(coord);
+        return;
+    }
+    
+    ivec2 base = coord * 2;
+    float depth = max(max(fetchDepth(base), fetchDepth(base + ivec2(1, 0))),
+                      max(fetchDepth(base + ivec2(0, 1)), fetchDepth(base + ivec2(1, 1))));
+    
+    // Tek genişlik/yükseklikte üçüncü sütun/satır bu texel'e düşer
+    bool extraColumn = (sourceSize.x & 1) != 0 && base.x + 3 == sourceSize.x;
+    bool extraRow = (sourceSize.y & 1) != 0 && base.y + 3 == sourceSize.y;
+    if (extraColumn)
+        depth = max(depth, max(fetchDepth(base + ivec2(2, 0)), fetchDepth(base + ivec2(2, 1))));
+    if (extraRow)
+        depth = max(depth, max(fetchDepth(base + ivec2(0, 2)), fetchDepth(base + ivec2(1, 2))));
+    if (extraColumn && extraRow)
+        depth = max(depth, fetchDepth(base + ivec2(2, 2)));
+    
+    hiZDepth = depth;
+}
@@ -0,0 +1,38 @@
+#version 330 core
+
+// Çoklu görünüm vertex shader'ı - tüm görünümlerin matrisleri tek bir uniform tamponunda
+// Görünüm başına yalnızca viewIndex değişir; örnek verisi tüm görünümler için tek tamponda
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+layout (location = 2) in vec4 aInstanceOffset; // Konum (xyz) ve ölçek (w)
+layout (location = 3) in vec4 aInstanceColor;  // Renk çarpanı (rgb) ve saydamlık (a)
+layout (location = 4) in vec3 aNormal;
+layout (location = 5) in vec2 aTexCoord;
+
+out vec3 vertexColor;
+out float vertexAlpha;
+out vec3 worldPosition;
+out vec3 worldNormal;
+out float viewDepth;
+out vec2 texCoord;
+
+const int MAX_VIEWS = 8;
+layout (std140) uniform Views {
+    mat4 viewProjections[MAX_VIEWS];
+};
+
+uniform int viewIndex;
+uniform mat4 model;
+
+void main() {
+    vec3 position = aPos * aInstanceOffset.w + aInstanceOffset.xyz;
+    vec4 world = model * vec4(position, 1.0);
+    gl_Position = viewProjections[viewIndex] * world;
+    worldPosition = world.xyz;
+    worldNormal = mat3(model) * aNormal;
+    viewDepth = gl_Position.w;
+    vertexColor = aColor * aInstanceColor.rgb;
+    vertexAlpha = aInstanceColor.a;
+    texCoord = aTexCoord;
+}
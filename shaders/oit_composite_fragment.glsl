@@ -0,0 +1,24 @@
+#version 330 core
+
+// Ağırlıklı karıştırmalı OIT - birleştirme geçişi
+// Biriken renk ağırlığa bölünerek ortalanır ve opak sahnenin üzerine
+// (SRC_ALPHA, ONE_MINUS_SRC_ALPHA) ile karıştırılır
+
+out vec4 FragColor;
+
+uniform sampler2D accumTexture;  // rgb: ağırlıklı renk toplamı, a: görünürlük
+uniform sampler2D weightTexture; // r: ağırlık toplamı
+
+void main() {
+    ivec2 coord = ivec2(gl_FragCoord.xy);
+    vec4 accum = texelFetch(accumTexture, coord, 0);
+    float revealage = accum.a;
+    
+    // Bu pikselde saydam yüzey yok - opak rengi koru
+    if (revealage >= 0.9999)
+        discard;
+    
+    float weight = texelFetch(weightTexture, coord, 0).r;
+    vec3 averageColor = accum.rgb / max(weight, 1e-5);
+    FragColor = vec4(averageColor, 1.0 - revealage);
+}
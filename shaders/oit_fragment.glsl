@@ -0,0 +1,38 @@
+#version 330 core
+
+// Ağırlıklı karıştırmalı sıradan bağımsız saydamlık (Weighted Blended OIT) - birikim geçişi
+// Tek bir blend fonksiyonu (GL 3.3'te hedef başına blend yok) ile iki hedef doldurulur:
+//   hedef 0: rgb = Σ renk * alfa * ağırlık,  a = Π (1 - alfa)  (görünürlük / revealage)
+//   hedef 1: r   = Σ alfa * ağırlık
+
+// Vertex shader'dan gelen veriler
+in vec3 vertexColor;
+in float vertexAlpha;
+in vec3 worldNormal;
+in float viewDepth; // Kameraya olan doğrusal derinlik
+
+// Çıkış hedefleri
+layout (location = 0) out vec4 accumColor;
+layout (location = 1) out float accumWeight;
+
+// Uniform değişkenler
+uniform float ambientStrength = 0.3; // Ortam ışık şiddeti
+uniform vec3 lightDirection = vec3(-0.4, -0.8, -0.3); // Işığın ilerleme yönü (ışıktan sahneye)
+uniform vec3 lightColor = vec3(1.0);
+
+void main() {
+    // fragment.glsl ile aynı ortam + yaygın ışık hesabı (saydam yüzeyler gölge almaz)
+    vec3 baseColor = vertexColor;
+    float diffuse = max(dot(normalize(worldNormal), normalize(-lightDirection)), 0.0);
+    vec3 color = ambientStrength * baseColor + baseColor * (1.0 - ambientStrength) * diffuse * lightColor;
+    float alpha = vertexAlpha;
+    
+    // Doğrusal görünüm derinliğine bağlı ağırlık (McGuire & Bavoil 2013, denklem 7 biçimi) - kameraya
+    // yakın yüzeyler baskın olur. Üst sınır 8: RGBA16F / R16F hedeflerinde (en fazla ~65504) piksel
+    // başına binlerce katmanın toplamı taşmaz; bölme birleştirmede yapıldığından yalnızca oran önemli
+    float weight = clamp(0.25 / (1e-5 + pow(viewDepth / 5.0, 2.0) + pow(viewDepth / 200.0, 6.0)), 1e-3, 8.0);
+    
+    // Alfa kanalı blend ile çarpılarak görünürlüğe dönüşür (ZERO, ONE_MINUS_SRC_ALPHA)
+    accumColor = vec4(color * alpha * weight, alpha);
+    accumWeight = alpha * weight;
+}
@@ -0,0 +1,10 @@
+#version 330 core
+
+// Parçacık noktaları - ışıklandırma yok, renk simülasyondan gelir
+in vec3 particleColor;
+
+out vec4 FragColor;
+
+void main() {
+    FragColor = vec4(particleColor, 1.0);
+}
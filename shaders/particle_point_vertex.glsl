@@ -0,0 +1,16 @@
+#version 330 core
+
+// Parçacıkları nokta olarak çizer - girdi doğrudan simülasyon tamponudur
+
+layout (location = 0) in vec4 aPositionSize;
+layout (location = 1) in vec4 aColor;
+
+out vec3 particleColor;
+
+uniform mat4 view;
+uniform mat4 projection;
+
+void main() {
+    gl_Position = projection * view * vec4(aPositionSize.xyz, 1.0);
+    particleColor = aColor.rgb;
+}
@@ -0,0 +1,82 @@
+#version 330 core
+
+// Parçacık simülasyonu - bir adım (transform feedback ile, rasterizer kapalı)
+// Her nokta bir parçacıktır; çıktı diğer tampona yazılır ve bir sonraki adımın girdisi olur
+// Adım particles.cpp'deki CPU referansıyla aynı sırada hesaplanır (doğrulama için)
+
+layout (location = 0) in vec4 aPositionSize; // Konum (xyz) ve küp ölçeği (w)
+layout (location = 1) in vec4 aColor;
+layout (location = 2) in vec4 aVelocityLife; // Hız (xyz) ve kalan ömür (w)
+
+out vec4 outPositionSize;
+out vec4 outColor;
+out vec4 outVelocityLife;
+
+uniform float deltaTime;
+uniform vec3 gravityStep; // gravity * deltaTime (CPU'da hesaplanır)
+uniform float damping;    // 1 - drag * deltaTime (CPU'da hesaplanır)
+uniform int frameSeed;    // Adım sayacı - yeniden doğma özetine girer
+
+// Yayıcı
+uniform vec3 emitterPosition;
+uniform float emitterRadius;
+uniform float speedMin;
+uniform float speedMax;
+uniform float spread;
+uniform float lifetimeMin;
+uniform float lifetimeMax;
+
+uniform float floorHeight;
+uniform float restitution;
+uniform float particleSize;
+
+// Tamsayı özeti - CPU'da bit düzeyinde aynı sonucu verir
+uint hash(uint x) {
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+// [0, 1) - 24 bit, float'a kayıpsız dönüşür
+float random01(inout uint state) {
+    state = hash(state);
+    return float(state >> 8u) * (1.0 / 16777216.0);
+}
+
+void main() {
+    float life = aVelocityLife.w - deltaTime;
+    vec3 position;
+    vec3 velocity;
+    
+    if (life <= 0.0) {
+        // Yayıcı diskinde yeniden doğ - rastgele sayılar CPU ile aynı sırada çekilir
+        uint state = hash(uint(gl_VertexID) ^ hash(uint(frameSeed)));
+        float angle = random01(state) * 6.2831853;
+        float radius = sqrt(random01(state)) * emitterRadius;
+        float direction = random01(state) * 6.2831853;
+        float horizontal = random01(state) * spread;
+        float speed = speedMin + random01(state) * (speedMax - speedMin);
+        life = lifetimeMin + random01(state) * (lifetimeMax - lifetimeMin);
+        
+        position = emitterPosition + vec3(cos(angle) * radius, 0.0, sin(angle) * radius);
+        velocity = vec3(cos(direction) * horizontal, speed, sin(direction) * horizontal);
+    } else {
+        velocity = (aVelocityLife.xyz + gravityStep) * damping;
+        position = aPositionSize.xyz + velocity * deltaTime;
+        
+        // Zeminde sek
+        if (position.y < floorHeight) {
+            position.y = floorHeight;
+            velocity.y = -velocity.y * restitution;
+        }
+    }
+    
+    // Genç parçacıklar büyük ve sıcak (beyaz-sarı), yaşlandıkça küçülür ve kırmızıya döner
+    float t = clamp(life / lifetimeMax, 0.0, 1.0);
+    outPositionSize = vec4(position, particleSize * (0.4 + 0.6 * t));
+    outColor = vec4(1.0, 0.2 + 0.8 * t, 0.05 + 0.6 * t * t, 1.0);
+    outVelocityLife = vec4(velocity, life);
+}
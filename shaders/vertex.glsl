@@ -1,11 +1,33 @@
 #version 330 core
 
+// Özellik bayrakları C++ tarafında #version satırının ardına #define olarak eklenir (shader_permutations.h):
+//   INSTANCING     - örnek başına konum/ölçek ve renk öznitelikleri
+//   DEBUG_POSITION - renk yerel konumdan hesaplanır
+
 // Vertex giriş verileri
 layout (location = 0) in vec3 aPos;    // Vertex pozisyonu (x, y, z)
 layout (location = 1) in vec3 aColor;  // Vertex rengi (r, g, b)
+layout (location = 4) in vec3 aNormal; // Yüz normali (yerel uzayda)
+layout (location = 5) in vec2 aTexCoord; // Doku koordinatı (u, v)
+
+#ifdef INSTANCING
+// Örnek (instance) başına veriler
+layout (location = 2) in vec4 aInstanceOffset; // Konum (xyz) ve ölçek (w)
+layout (location = 3) in vec4 aInstanceColor;  // Renk çarpanı (rgb) ve saydamlık (a)
+#endif
+
+// Derinlik ön geçişi aynı vertex shader'ı farklı bir programda kullanır;
+// GL_LEQUAL ile eşleşmesi için konum hesabı programlar arasında birebir aynı olmalı
+// (iki program da aynı INSTANCING bayrağıyla derlenmeli)
+invariant gl_Position;
 
 // Fragment shader'a çıkış verileri
 out vec3 vertexColor;  // Fragment shader'a aktarılacak renk bilgisi
+out float vertexAlpha; // Fragment shader'a aktarılacak saydamlık
+out vec3 worldPosition; // Dünya uzayındaki konum (aydınlatma ve gölge araması için)
+out vec3 worldNormal;   // Dünya uzayındaki normal
+out float viewDepth;    // Kameraya olan derinlik (gölge kademesi seçimi için)
+out vec2 texCoord;      // Doku koordinatı
 
 // Uniform değişkenler (her çizimdeki ortak veriler)
 uniform mat4 model;      // Model matrisi (yerel koordinatlardan dünya koordinatlarına)
@@ -13,14 +35,33 @@ uniform mat4 view;       // Görünüm matrisi (dünya koordinatlarından kamera
 uniform mat4 projection; // Projeksiyon matrisi (kamera koordinatlarından kesme koordinatlarına)
 
 void main() {
+#ifdef INSTANCING
+    // Örneğin ölçek ve konumunu uygula
+    vec3 position = aPos * aInstanceOffset.w + aInstanceOffset.xyz;
+    vec4 instanceColor = aInstanceColor;
+#else
+    vec3 position = aPos;
+    vec4 instanceColor = vec4(1.0);
+#endif
+    
     // MVP matrisi uygulaması (Model-View-Projection)
     // Vertex konumunun 4D homojen koordinatlar olarak hesaplanması
     // Matris dönüşümleri sağdan sola doğru uygulanır
-    gl_Position = projection * view * model * vec4(aPos, 1.0);
+    vec4 world = model * vec4(position, 1.0);
+    gl_Position = projection * view * world;
     
-    // Vertex rengini fragment shader'a ilet
-    vertexColor = aColor;
+    // Model matrisi yalnızca dönüş, örnek ölçeği tekdüze - normal için ters-devrik gerekmez
+    worldPosition = world.xyz;
+    worldNormal = mat3(model) * aNormal;
+    viewDepth = gl_Position.w; // Perspektif projeksiyonda w = -z (görünüm uzayı)
     
-    // Alternatif olarak, pozisyona göre renk hesaplanabilir
-    // vertexColor = 0.5 * (aPos + vec3(1.0, 1.0, 1.0)); // Pozisyona göre renklendirme
-}
\ No newline at end of file
+#ifdef DEBUG_POSITION
+    // Pozisyona göre renklendirme
+    vertexColor = 0.5 * (aPos + vec3(1.0, 1.0, 1.0));
+#else
+    // Vertex rengini fragment shader'a ilet
+    vertexColor = aColor * instanceColor.rgb;
+#endif
+    vertexAlpha = instanceColor.a;
+    texCoord = aTexCoord;
+}
@@ -0,0 +1,210 @@
+#include "shadows.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+#include "matrix_utils.h"
+
+bool CascadedShadowMap::init(unsigned int cascadeCount, int resolution) {
+    // Yukarıdan, hafif eğik gelen ışık
+    const float direction[3] = { -0.4f, -0.8f, -0.3f };
+    float length = std::sqrt(direction[0] * direction[0] + direction[1] * direction[1] + direction[2] * direction[2]);
+    for (int i = 0; i < 3; i++) {
+        lightDirection[i] = direction[i] / length;
+    }
+
+    size = resolution;
+    setCascadeCount(cascadeCount);
+    return true;
+}
+
+void CascadedShadowMap::setCascadeCount(unsigned int cascadeCount) {
+    destroyTargets();
+    count = std::min(cascadeCount, MAX_CASCADES);
+    if (count > 0) {
+        createTargets();
+    }
+    castersPerCascade.assign(count, 0);
+}
+
+void CascadedShadowMap::createTargets() {
+    // Karşılaştırmalı örnekleme (sampler2DArrayShadow) - doğrusal süzme donanım 2x2 PCF'i verir
+    glGenTextures(1, &depthArray);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, depthArray);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_DEPTH_COMPONENT24, size, size, count, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+    framebuffers.resize(count);
+    glGenFramebuffers(count, framebuffers.data());
+    const GLenum noColor = GL_NONE;
+    for (unsigned int i = 0; i < count; i++) {
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffers[i]);
+        glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, depthArray, 0, i);
+        glDrawBuffers(1, &noColor);
+        glReadBuffer(GL_NONE);
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+            std::cerr << "HATA: Gölge kademesi framebuffer'ı eksik (" << i << ")" << std::endl;
+        }
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void CascadedShadowMap::destroyTargets() {
+    if (!framebuffers.empty()) {
+        glDeleteFramebuffers(static_cast<GLsizei>(framebuffers.size()), framebuffers.data());
+        framebuffers.clear();
+    }
+    glDeleteTextures(1, &depthArray);
+    depthArray = 0;
+}
+
+void CascadedShadowMap::update(const float* cameraView, float fov, float aspect, float nearPlane) {
+    views.clear();
+    if (count == 0) {
+        return;
+    }
+
+    // Kamera tabanı - görünüm matrisinin satırları
+    float position[3];
+    MatrixUtils::extractCameraPosition(position, cameraView);
+    const float right[3] = { cameraView[0], cameraView[4], cameraView[8] };
+    const float up[3] = { cameraView[1], cameraView[5], cameraView[9] };
+    const float forward[3] = { -cameraView[2], -cameraView[6], -cameraView[10] };
+    const float tanHalfFov = std::tan(fov / 2.0f);
+
+    // Pratik bölme şeması - logaritmik ve doğrusal bölmenin karışımı
+    for (unsigned int i = 0; i < count; i++) {
+        float t = (float)(i + 1) / (float)count;
+        float logarithmic = nearPlane * std::pow(shadowDistance / nearPlane, t);
+        float linear = nearPlane + (shadowDistance - nearPlane) * t;
+        splits[i] = splitLambda * logarithmic + (1.0f - splitLambda) * linear;
+    }
+
+    // Işık görünümünün yukarı vektörü - ışık dikeye yakınsa z ekseni
+    float lightUp[3] = { 0.0f, 1.0f, 0.0f };
+    if (std::fabs(lightDirection[1]) > 0.99f) {
+        lightUp[1] = 0.0f;
+        lightUp[2] = 1.0f;
+    }
+
+    // Işık yönünde kademenin önünde kalan gölge düşürücüler için ek mesafe
+    const float casterMargin = 30.0f;
+
+    float sliceNear = nearPlane;
+    for (unsigned int c = 0; c < count; c++) {
+        float sliceFar = splits[c];
+
+        // Dilimin sekiz köşesi
+        float corners[8][3];
+        for (int k = 0; k < 8; k++) {
+            float depth = (k & 4) ? sliceFar : sliceNear;
+            float halfHeight = depth * tanHalfFov;
+            float halfWidth = halfHeight * aspect;
+            float sx = (k & 1) ? 1.0f : -1.0f;
+            float sy = (k & 2) ? 1.0f : -1.0f;
+            for (int a = 0; a < 3; a++) {
+                corners[k][a] = position[a] + forward[a] * depth + right[a] * sx * halfWidth + up[a] * sy * halfHeight;
+            }
+        }
+
+        // Çevreleyen küre - yarıçap kamera dönüşünden bağımsız olduğundan kademe boyutu sabit kalır
+        float center[3] = { 0.0f, 0.0f, 0.0f };
+        for (int k = 0; k < 8; k++) {
+            for (int a = 0; a < 3; a++) {
+                center[a] += corners[k][a] / 8.0f;
+            }
+        }
+        float radius = 0.0f;
+        for (int k = 0; k < 8; k++) {
+            float dx = corners[k][0] - center[0];
+            float dy = corners[k][1] - center[1];
+            float dz = corners[k][2] - center[2];
+            radius = std::max(radius, std::sqrt(dx * dx + dy * dy + dz * dz));
+        }
+        radius = std::ceil(radius * 16.0f) / 16.0f;
+
+        View view;
+        float eye[3];
+        for (int a = 0; a < 3; a++) {
+            eye[a] = center[a] - lightDirection[a] * (radius + casterMargin);
+        }
+        MatrixUtils::createViewMatrix(view.view, eye, center, lightUp);
+        MatrixUtils::createOrthographicMatrix(view.projection, -radius, radius, -radius, radius,
+                                              0.0f, 2.0f * radius + casterMargin);
+
+        // Dünya başlangıç noktasının gölge haritasındaki konumu texel ızgarasına yuvarlanır;
+        // kalan kesir projeksiyona öteleme olarak eklenir - kamera kaydıkça kademe tam texel adımlarıyla kayar
+        MatrixUtils::multiply(view.viewProjection, view.projection, view.view);
+        float halfSize = size * 0.5f;
+        float originX = view.viewProjection[12] * halfSize;
+        float originY = view.viewProjection[13] * halfSize;
+        view.projection[12] += (std::round(originX) - originX) / halfSize;
+        view.projection[13] += (std::round(originY) - originY) / halfSize;
+
+        view.viewport[0] = 0;
+        view.viewport[1] = 0;
+        view.viewport[2] = size;
+        view.viewport[3] = size;
+        view.framebuffer = framebuffers[c];
+        view.depthOnly = true;
+        finalizeView(view);
+        views.push_back(view);
+
+        texelSizes[c] = 2.0f * radius / (float)size;
+        sliceNear = sliceFar;
+    }
+}
+
+void CascadedShadowMap::cull(MultiViewRenderer& renderer) {
+    if (views.empty()) {
+        return;
+    }
+
+    // Kademe elemesi çoklu görünüm çizicisinin tek geçişli elemesiyle yapılır
+    renderer.cullAndRecord(views);
+    castersPerCascade = renderer.visiblePerView;
+    lastCullMs = renderer.lastCullMs;
+}
+
+void CascadedShadowMap::render(MultiViewRenderer& renderer, const float* centerModel) {
+    if (views.empty()) {
+        return;
+    }
+
+    // Eğime göre ölçeklenen derinlik kaydırması - normal kaydırmasını tamamlar
+    glEnable(GL_POLYGON_OFFSET_FILL);
+    glPolygonOffset(1.5f, 2.0f);
+    renderer.execute(views, centerModel, 0.0f);
+    glDisable(GL_POLYGON_OFFSET_FILL);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void CascadedShadowMap::apply(const Shader& shader) const {
+    shader.setInt("cascadeCount", (int)views.size());
+    shader.setInt("shadowMap", SHADOW_TEXTURE_UNIT);
+    shader.setVec3("lightDirection", lightDirection[0], lightDirection[1], lightDirection[2]);
+    for (unsigned int i = 0; i < views.size(); i++) {
+        std::string index = "[" + std::to_string(i) + "]";
+        shader.setFloat("cascadeSplits" + index, splits[i]);
+        shader.setMat4("lightViewProjections" + index, views[i].viewProjection);
+        shader.setFloat("normalOffset" + index, texelSizes[i] * 1.5f);
+    }
+
+    glActiveTexture(GL_TEXTURE0 + SHADOW_TEXTURE_UNIT);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, depthArray);
+    glActiveTexture(GL_TEXTURE0);
+}
+
+void CascadedShadowMap::destroy() {
+    destroyTargets();
+    views.clear();
+    count = 0;
+}
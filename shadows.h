@@ -0,0 +1,62 @@
+#ifndef SHADOWS_H
+#define SHADOWS_H
+
+#include <glad/glad.h>
+#include <vector>
+
+#include "multiview.h"
+#include "shader.h"
+#include "texture_units.h"
+
+// fragment.glsl'deki MAX_CASCADES ile eşleşir
+const unsigned int MAX_CASCADES = 4;
+
+// Yönlü ışık için kademeli gölge haritaları (cascaded shadow maps)
+// Kamera kesik piramidi derinlik boyunca bölünür; her kademe kendi ortografik ışık kamerasıyla
+// bir derinlik dokusu dizisinin bir katmanına yalnızca derinlik olarak çizilir
+class CascadedShadowMap {
+public:
+    float lightDirection[3];           // Işığın ilerleme yönü (normalize)
+    float shadowDistance = 40.0f;      // Gölgelerin çizildiği en uzak görünüm derinliği
+    float splitLambda = 0.75f;         // 0: doğrusal bölme, 1: logaritmik bölme
+    float lastCullMs = 0.0f;           // Son kademe elemesi + kayıt süresi
+    std::vector<unsigned int> castersPerCascade; // Kademe başına gölge düşüren örnek sayısı
+
+    bool init(unsigned int cascadeCount, int resolution);
+
+    // Kademe sayısını değiştirir (0 - MAX_CASCADES); 0 gölgeleri kapatır
+    void setCascadeCount(unsigned int cascadeCount);
+    unsigned int cascadeCount() const { return count; }
+    int resolution() const { return size; }
+
+    // Kamera kesik piramidini böler ve kademe matrislerini hesaplar
+    // Projeksiyonlar texel ızgarasına hizalanır - kamera hareket ederken gölge kenarları titremez
+    void update(const float* cameraView, float fov, float aspect, float nearPlane);
+
+    // Kademe dökücülerini eler ve komut akışını kaydeder (CPU); eleme çoklu görünüm çiziciyle paylaşılır
+    // (her kademe, opak küp alanı için yalnızca derinlik yazan bir görünümdür)
+    void cull(MultiViewRenderer& renderer);
+
+    // cull() ile kaydedilen akışla tüm kademeleri çizer
+    void render(MultiViewRenderer& renderer, const float* centerModel);
+
+    // Gölge uniform'larını ve dokusunu fragment.glsl kullanan programa bağlar
+    void apply(const Shader& shader) const;
+
+    void destroy();
+
+private:
+    unsigned int depthArray = 0;             // DEPTH24 doku dizisi, kademe başına bir katman
+    std::vector<unsigned int> framebuffers;  // Katman başına yalnızca derinlik hedefi
+    unsigned int count = 0;
+    int size = 1024;
+
+    std::vector<View> views;
+    float splits[MAX_CASCADES];        // Kademelerin uzak sınırları
+    float texelSizes[MAX_CASCADES];    // Bir texelin dünya uzayındaki boyutu
+
+    void createTargets();
+    void destroyTargets();
+};
+
+#endif // SHADOWS_H
@@ -0,0 +1,43 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+
+// Tek üretici / tek tüketici kilitsiz halka kuyruk
+// Üretici yalnızca writeIndex'i, tüketici yalnızca readIndex'i yazar; iki indeks ayrı önbellek
+// satırlarında tutulur, böylece iki iş parçacığı birbirinin satırını sürekli geçersiz kılmaz
+template <typename T, size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Kapasite 2'nin kuvveti olmalı");
+
+public:
+    // Üretici iş parçacığından çağrılır; kuyruk doluysa false döner (öğe düşürülür)
+    bool push(const T& item) {
+        size_t write = writeIndex.load(std::memory_order_relaxed);
+        if (write - readIndex.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+        buffer[write & (Capacity - 1)] = item;
+        writeIndex.store(write + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Tüketici iş parçacığından çağrılır; kuyruk boşsa false döner
+    bool pop(T& item) {
+        size_t read = readIndex.load(std::memory_order_relaxed);
+        if (read == writeIndex.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = buffer[read & (Capacity - 1)];
+        readIndex.store(read + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    alignas(64) std::atomic<size_t> writeIndex{0};
+    alignas(64) std::atomic<size_t> readIndex{0};
+    alignas(64) T buffer[Capacity];
+};
+
+#endif // SPSC_QUEUE_H
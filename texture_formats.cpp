@@ -0,0 +1,736 @@
+#include "texture_formats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+// GL_EXT_texture_compression_s3tc, RGTC (GL 3.0), BPTC (GL 4.2) ve ETC2 (GL 4.3) iç biçimleri
+const char* textureFormatName(TextureFormat format) {
+    switch (format) {
+        case TextureFormat::RGBA8: return "RGBA8";
+        case TextureFormat::BC1: return "BC1";
+        case TextureFormat::BC3: return "BC3";
+        case TextureFormat::BC4: return "BC4";
+        case TextureFormat::BC5: return "BC5";
+        case TextureFormat::BC7: return "BC7";
+        case TextureFormat::ETC2_RGB8: return "ETC2";
+    }
+    return "?";
+}
+
+bool isBlockCompressed(TextureFormat format) {
+    return format != TextureFormat::RGBA8;
+}
+
+GLenum textureFormatGLEnum(TextureFormat format) {
+    switch (format) {
+        case TextureFormat::RGBA8: return GL_RGBA8;
+        case TextureFormat::BC1: return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+        case TextureFormat::BC3: return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        case TextureFormat::BC4: return GL_COMPRESSED_RED_RGTC1;
+        case TextureFormat::BC5: return GL_COMPRESSED_RG_RGTC2;
+        case TextureFormat::BC7: return GL_COMPRESSED_RGBA_BPTC_UNORM;
+        case TextureFormat::ETC2_RGB8: return GL_COMPRESSED_RGB8_ETC2;
+    }
+    return GL_RGBA8;
+}
+
+size_t textureLevelSize(TextureFormat format, int width, int height) {
+    if (!isBlockCompressed(format)) {
+        return (size_t)width * height * 4;
+    }
+    size_t blocks = (size_t)((width + 3) / 4) * ((height + 3) / 4);
+    bool eightByteBlocks = format == TextureFormat::BC1 || format == TextureFormat::BC4 || format == TextureFormat::ETC2_RGB8;
+    return blocks * (eightByteBlocks ? 8 : 16);
+}
+
+size_t TextureData::bytesFrom(int firstLevel) const {
+    size_t total = 0;
+    for (int level = std::max(firstLevel, 0); level < levelCount(); level++) {
+        total += levels[level].size();
+    }
+    return total;
+}
+
+namespace {
+    // Dosya biçimleri küçük uçlu (little-endian)
+    uint32_t readU32(const unsigned char* p) {
+        return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    }
+
+    uint64_t readU64(const unsigned char* p) {
+        return (uint64_t)readU32(p) | ((uint64_t)readU32(p + 4) << 32);
+    }
+
+    uint32_t fourCC(const char* code) {
+        return readU32(reinterpret_cast<const unsigned char*>(code));
+    }
+
+    // En büyük kabul edilen kenar (yaygın GL_MAX_TEXTURE_SIZE). Sıfır boyut mip seçiminde log2(0),
+    // 2^31 ve üstü negatif int üretir; mip zincirinden uzun seviye sayısı taşan kaydırma demektir
+    const uint32_t MAX_TEXTURE_DIMENSION = 16384;
+
+    bool validDimensions(uint32_t width, uint32_t height, uint32_t levelCount, const std::string& path) {
+        if (width == 0 || height == 0 || width > MAX_TEXTURE_DIMENSION || height > MAX_TEXTURE_DIMENSION) {
+            std::cerr << "HATA: Geçersiz doku boyutu " << width << "x" << height << ": " << path << std::endl;
+            return false;
+        }
+        uint32_t maxLevels = 1;
+        while ((std::max(width, height) >> maxLevels) > 0) {
+            maxLevels++;
+        }
+        if (levelCount > maxLevels) {
+            std::cerr << "HATA: Geçersiz mip seviyesi sayısı " << levelCount << ": " << path << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    bool readFileBytes(const std::string& path, std::vector<unsigned char>& bytes) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            std::cerr << "HATA: Doku dosyası okunamadı: " << path << std::endl;
+            return false;
+        }
+        bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return true;
+    }
+
+    // Seviyeleri art arda duran veriden kopyalar; dosya kısaysa false
+    bool copyLevels(const std::vector<unsigned char>& bytes, size_t offset, int levelCount, TextureData& out,
+                    const std::string& path) {
+        out.levels.clear();
+        for (int level = 0; level < levelCount; level++) {
+            size_t size = textureLevelSize(out.format, out.levelWidth(level), out.levelHeight(level));
+            if (offset > bytes.size() || size > bytes.size() - offset) {
+                std::cerr << "HATA: Doku dosyası kısa (seviye " << level << "): " << path << std::endl;
+                return false;
+            }
+            out.levels.emplace_back(bytes.begin() + offset, bytes.begin() + offset + size);
+            offset += size;
+        }
+        return true;
+    }
+
+    bool parseDDS(const std::vector<unsigned char>& bytes, const std::string& path, TextureData& out) {
+        const unsigned char* header = bytes.data();
+        if (bytes.size() < 128 || readU32(header + 4) != 124) {
+            std::cerr << "HATA: Bozuk DDS başlığı: " << path << std::endl;
+            return false;
+        }
+
+        const uint32_t DDSD_MIPMAPCOUNT = 0x20000;
+        const uint32_t DDPF_FOURCC = 0x4;
+        const uint32_t DDPF_RGB = 0x40;
+        const uint32_t DDSCAPS2_CUBEMAP = 0x200;
+
+        uint32_t flags = readU32(header + 8);
+        uint32_t height = readU32(header + 12);
+        uint32_t width = readU32(header + 16);
+        uint32_t mipCount = (flags & DDSD_MIPMAPCOUNT) ? std::max(1u, readU32(header + 28)) : 1u;
+        if (!validDimensions(width, height, mipCount, path)) {
+            return false;
+        }
+        out.width = static_cast<int>(width);
+        out.height = static_cast<int>(height);
+        uint32_t pixelFlags = readU32(header + 80);
+        uint32_t code = readU32(header + 84);
+        size_t offset = 128;
+        bool swapRedBlue = false;
+
+        if (readU32(header + 112) & DDSCAPS2_CUBEMAP) {
+            std::cerr << "HATA: Küp haritası DDS desteklenmiyor: " << path << std::endl;
+            return false;
+        }
+
+        if ((pixelFlags & DDPF_FOURCC) && code == fourCC("DX10")) {
+            if (bytes.size() < 148) {
+                std::cerr << "HATA: Bozuk DDS DX10 başlığı: " << path << std::endl;
+                return false;
+            }
+            uint32_t dxgiFormat = readU32(header + 128);
+            uint32_t arraySize = readU32(header + 140);
+            offset = 148;
+            if (arraySize > 1) {
+                std::cerr << "HATA: Doku dizisi DDS desteklenmiyor: " << path << std::endl;
+                return false;
+            }
+            // sRGB varyantları doğrusal olarak yüklenir
+            switch (dxgiFormat) {
+                case 28: case 29: out.format = TextureFormat::RGBA8; break;
+                case 71: case 72: out.format = TextureFormat::BC1; break;
+                case 77: case 78: out.format = TextureFormat::BC3; break;
+                case 80: out.format = TextureFormat::BC4; break;
+                case 83: out.format = TextureFormat::BC5; break;
+                case 98: case 99: out.format = TextureFormat::BC7; break;
+                default:
+                    std::cerr << "HATA: Desteklenmeyen DXGI biçimi " << dxgiFormat << ": " << path << std::endl;
+                    return false;
+            }
+        } else if (pixelFlags & DDPF_FOURCC) {
+            if (code == fourCC("DXT1")) {
+                out.format = TextureFormat::BC1;
+            } else if (code == fourCC("DXT5")) {
+                out.format = TextureFormat::BC3;
+            } else if (code == fourCC("ATI1") || code == fourCC("BC4U")) {
+                out.format = TextureFormat::BC4;
+            } else if (code == fourCC("ATI2") || code == fourCC("BC5U")) {
+                out.format = TextureFormat::BC5;
+            } else {
+                std::cerr << "HATA: Desteklenmeyen DDS FourCC biçimi: " << path << std::endl;
+                return false;
+            }
+        } else if ((pixelFlags & DDPF_RGB) && readU32(header + 88) == 32) {
+            // 32 bit RGBA ya da BGRA
+            uint32_t redMask = readU32(header + 92);
+            if (redMask != 0x000000ffu && redMask != 0x00ff0000u) {
+                std::cerr << "HATA: Desteklenmeyen DDS piksel düzeni: " << path << std::endl;
+                return false;
+            }
+            out.format = TextureFormat::RGBA8;
+            swapRedBlue = redMask == 0x00ff0000u;
+        } else {
+            std::cerr << "HATA: Desteklenmeyen DDS piksel biçimi: " << path << std::endl;
+            return false;
+        }
+
+        if (!copyLevels(bytes, offset, static_cast<int>(mipCount), out, path)) {
+            return false;
+        }
+        if (swapRedBlue) {
+            for (std::vector<unsigned char>& level : out.levels) {
+                for (size_t i = 0; i + 3 < level.size(); i += 4) {
+                    std::swap(level[i], level[i + 2]);
+                }
+            }
+        }
+        return true;
+    }
+
+    bool parseKTX2(const std::vector<unsigned char>& bytes, const std::string& path, TextureData& out) {
+        const unsigned char* header = bytes.data();
+        if (bytes.size() < 80) {
+            std::cerr << "HATA: Bozuk KTX2 başlığı: " << path << std::endl;
+            return false;
+        }
+
+        uint32_t vkFormat = readU32(header + 12);
+        uint32_t width = readU32(header + 20);
+        uint32_t height = std::max(1u, readU32(header + 24)); // 0: tek boyutlu doku
+        uint32_t depth = readU32(header + 28);
+        uint32_t layers = readU32(header + 32);
+        uint32_t faces = readU32(header + 36);
+        uint32_t levelCount = std::max(1u, readU32(header + 40));
+        uint32_t supercompression = readU32(header + 44);
+
+        if (depth > 1 || layers > 1 || faces != 1) {
+            std::cerr << "HATA: Yalnızca 2B KTX2 dokuları destekleniyor: " << path << std::endl;
+            return false;
+        }
+        if (supercompression != 0) {
+            std::cerr << "HATA: Süper sıkıştırmalı (Basis/Zstd) KTX2 desteklenmiyor: " << path << std::endl;
+            return false;
+        }
+        if (!validDimensions(width, height, levelCount, path)) {
+            return false;
+        }
+        out.width = static_cast<int>(width);
+        out.height = static_cast<int>(height);
+
+        // VkFormat değerleri - sRGB varyantları doğrusal olarak yüklenir
+        switch (vkFormat) {
+            case 37: case 43: out.format = TextureFormat::RGBA8; break;
+            case 131: case 132: case 133: case 134: out.format = TextureFormat::BC1; break;
+            case 137: case 138: out.format = TextureFormat::BC3; break;
+            case 139: out.format = TextureFormat::BC4; break;
+            case 141: out.format = TextureFormat::BC5; break;
+            case 145: case 146: out.format = TextureFormat::BC7; break;
+            case 147: case 148: out.format = TextureFormat::ETC2_RGB8; break;
+            default:
+                std::cerr << "HATA: Desteklenmeyen KTX2 VkFormat " << vkFormat << ": " << path << std::endl;
+                return false;
+        }
+
+        // Seviye indeksi başlığın hemen ardından gelir; seviye 0 ilk kayıttır
+        if (bytes.size() < 80 + (size_t)levelCount * 24) {
+            std::cerr << "HATA: Bozuk KTX2 seviye indeksi: " << path << std::endl;
+            return false;
+        }
+        out.levels.clear();
+        for (uint32_t level = 0; level < levelCount; level++) {
+            const unsigned char* entry = header + 80 + level * 24;
+            uint64_t offset = readU64(entry);
+            uint64_t length = readU64(entry + 8);
+            size_t size = textureLevelSize(out.format, out.levelWidth(level), out.levelHeight(level));
+            if (length < size || offset > bytes.size() || size > bytes.size() - offset) {
+                std::cerr << "HATA: Bozuk KTX2 seviyesi " << level << ": " << path << std::endl;
+                return false;
+            }
+            out.levels.emplace_back(bytes.begin() + offset, bytes.begin() + offset + size);
+        }
+        return true;
+    }
+
+    // 5:6:5 rengi 8 bit kanallara genişletir
+    void expand565(uint16_t color, unsigned char* rgba) {
+        int r = (color >> 11) & 31, g = (color >> 5) & 63, b = color & 31;
+        rgba[0] = (unsigned char)((r << 3) | (r >> 2));
+        rgba[1] = (unsigned char)((g << 2) | (g >> 4));
+        rgba[2] = (unsigned char)((b << 3) | (b >> 2));
+        rgba[3] = 255;
+    }
+
+    // BC1 renk bloğu - BC3 içindeki renk bloğu her zaman dört renklidir
+    void decodeBC1Block(const unsigned char* block, unsigned char* out, bool forceFourColor) {
+        uint16_t c0 = (uint16_t)(block[0] | (block[1] << 8));
+        uint16_t c1 = (uint16_t)(block[2] | (block[3] << 8));
+        unsigned char palette[4][4];
+        expand565(c0, palette[0]);
+        expand565(c1, palette[1]);
+        for (int k = 0; k < 3; k++) {
+            if (c0 > c1 || forceFourColor) {
+                palette[2][k] = (unsigned char)((2 * palette[0][k] + palette[1][k]) / 3);
+                palette[3][k] = (unsigned char)((palette[0][k] + 2 * palette[1][k]) / 3);
+            } else {
+                palette[2][k] = (unsigned char)((palette[0][k] + palette[1][k]) / 2);
+                palette[3][k] = 0;
+            }
+        }
+        palette[2][3] = 255;
+        palette[3][3] = (c0 > c1 || forceFourColor) ? 255 : 0;
+
+        uint32_t indices = readU32(block + 4);
+        for (int i = 0; i < 16; i++) {
+            const unsigned char* color = palette[(indices >> (2 * i)) & 3];
+            if (forceFourColor) {
+                std::memcpy(out + i * 4, color, 3); // Alfa ayrı bloktan gelir
+            } else {
+                std::memcpy(out + i * 4, color, 4);
+            }
+        }
+    }
+
+    // BC4 tek kanal bloğu - sonuç out'taki channel kanalına yazılır
+    void decodeBC4Block(const unsigned char* block, unsigned char* out, int channel) {
+        int a0 = block[0], a1 = block[1];
+        unsigned char values[8];
+        values[0] = (unsigned char)a0;
+        values[1] = (unsigned char)a1;
+        if (a0 > a1) {
+            for (int i = 1; i <= 6; i++) {
+                values[i + 1] = (unsigned char)(((7 - i) * a0 + i * a1) / 7);
+            }
+        } else {
+            for (int i = 1; i <= 4; i++) {
+                values[i + 1] = (unsigned char)(((5 - i) * a0 + i * a1) / 5);
+            }
+            values[6] = 0;
+            values[7] = 255;
+        }
+
+        uint64_t bits = 0;
+        for (int k = 0; k < 6; k++) {
+            bits |= (uint64_t)block[2 + k] << (8 * k);
+        }
+        for (int i = 0; i < 16; i++) {
+            out[i * 4 + channel] = values[(bits >> (3 * i)) & 7];
+        }
+    }
+
+    inline unsigned char clampByte(int value) {
+        return (unsigned char)std::min(255, std::max(0, value));
+    }
+
+    inline int extend4(int value) { return (value << 4) | value; }
+    inline int extend5(int value) { return (value << 3) | (value >> 2); }
+    inline int extend6(int value) { return (value << 2) | (value >> 4); }
+    inline int extend7(int value) { return (value << 1) | (value >> 6); }
+
+    // ETC2 RGB8 bloğu (büyük uçlu) - ETC1 bireysel/fark kipleri ve ETC2 T, H, düzlemsel kipleri
+    // Piksel indeksleri sütun sıralıdır (i = x * 4 + y); çıktı satır sıralı RGBA
+    void decodeETC2Block(const unsigned char* block, unsigned char* out) {
+        static const int modifiers[8][2] = {
+            { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 }
+        };
+        static const int distances[8] = { 3, 6, 11, 16, 23, 32, 41, 64 };
+
+        uint32_t high = ((uint32_t)block[0] << 24) | ((uint32_t)block[1] << 16) | ((uint32_t)block[2] << 8) | block[3];
+        uint32_t low = ((uint32_t)block[4] << 24) | ((uint32_t)block[5] << 16) | ((uint32_t)block[6] << 8) | block[7];
+        auto pixelIndex = [low](int x, int y) {
+            int i = x * 4 + y;
+            return (int)((((low >> (i + 16)) & 1) << 1) | ((low >> i) & 1));
+        };
+        auto store = [out](int x, int y, int r, int g, int b) {
+            unsigned char* pixel = out + (y * 4 + x) * 4;
+            pixel[0] = clampByte(r);
+            pixel[1] = clampByte(g);
+            pixel[2] = clampByte(b);
+            pixel[3] = 255;
+        };
+
+        bool differential = (high & 2) != 0;
+        int base[2][3];
+        if (differential) {
+            int channels[3], deltas[3];
+            for (int k = 0; k < 3; k++) {
+                channels[k] = block[k] >> 3;
+                deltas[k] = block[k] & 7;
+                if (deltas[k] >= 4) {
+                    deltas[k] -= 8;
+                }
+            }
+
+            if (channels[0] + deltas[0] < 0 || channels[0] + deltas[0] > 31) {
+                // T kipi
+                int color1[3] = { extend4((((block[0] >> 3) & 3) << 2) | (block[0] & 3)), extend4(block[1] >> 4), extend4(block[1] & 15) };
+                int color2[3] = { extend4(block[2] >> 4), extend4(block[2] & 15), extend4(block[3] >> 4) };
+                int d = distances[(((block[3] >> 2) & 3) << 1) | (block[3] & 1)];
+                int paint[4][3];
+                for (int k = 0; k < 3; k++) {
+                    paint[0][k] = color1[k];
+                    paint[1][k] = color2[k] + d;
+                    paint[2][k] = color2[k];
+                    paint[3][k] = color2[k] - d;
+                }
+                for (int y = 0; y < 4; y++) {
+                    for (int x = 0; x < 4; x++) {
+                        const int* color = paint[pixelIndex(x, y)];
+                        store(x, y, color[0], color[1], color[2]);
+                    }
+                }
+                return;
+            }
+
+            if (channels[1] + deltas[1] < 0 || channels[1] + deltas[1] > 31) {
+                // H kipi - renk bitleri taşma bitlerinin arasına dağılmış
+                uint32_t bits = (((high >> 24) & 0x7f) << 19) | (((high >> 19) & 3) << 17) | (((high >> 2) & 0xffff) << 1) | (high & 1);
+                int r1 = (bits >> 22) & 15, g1 = (bits >> 18) & 15, b1 = (bits >> 14) & 15;
+                int r2 = (bits >> 10) & 15, g2 = (bits >> 6) & 15, b2 = (bits >> 2) & 15;
+                int distanceIndex = (int)((bits & 3) << 1);
+                if (((r1 << 8) | (g1 << 4) | b1) >= ((r2 << 8) | (g2 << 4) | b2)) {
+                    distanceIndex |= 1;
+                }
+                int d = distances[distanceIndex];
+                int color1[3] = { extend4(r1), extend4(g1), extend4(b1) };
+                int color2[3] = { extend4(r2), extend4(g2), extend4(b2) };
+                int paint[4][3];
+                for (int k = 0; k < 3; k++) {
+                    paint[0][k] = color1[k] + d;
+                    paint[1][k] = color1[k] - d;
+                    paint[2][k] = color2[k] + d;
+                    paint[3][k] = color2[k] - d;
+                }
+                for (int y = 0; y < 4; y++) {
+                    for (int x = 0; x < 4; x++) {
+                        const int* color = paint[pixelIndex(x, y)];
+                        store(x, y, color[0], color[1], color[2]);
+                    }
+                }
+                return;
+            }
+
+            if (channels[2] + deltas[2] < 0 || channels[2] + deltas[2] > 31) {
+                // Düzlemsel kip - köşe renkleri arasında doğrusal geçiş
+                int origin[3] = {
+                    extend6((high >> 25) & 63),
+                    extend7((int)((((high >> 24) & 1) << 6) | ((high >> 17) & 63))),
+                    extend6((int)((((high >> 16) & 1) << 5) | (((high >> 11) & 3) << 3) | ((high >> 7) & 7)))
+                };
+                int horizontal[3] = {
+                    extend6((int)((((high >> 2) & 31) << 1) | (high & 1))),
+                    extend7((low >> 25) & 127),
+                    extend6((low >> 19) & 63)
+                };
+                int vertical[3] = { extend6((low >> 13) & 63), extend7((low >> 6) & 127), extend6(low & 63) };
+                for (int y = 0; y < 4; y++) {
+                    for (int x = 0; x < 4; x++) {
+                        int color[3];
+                        for (int k = 0; k < 3; k++) {
+                            color[k] = (x * (horizontal[k] - origin[k]) + y * (vertical[k] - origin[k]) + 4 * origin[k] + 2) >> 2;
+                        }
+                        store(x, y, color[0], color[1], color[2]);
+                    }
+                }
+                return;
+            }
+
+            for (int k = 0; k < 3; k++) {
+                base[0][k] = extend5(channels[k]);
+                base[1][k] = extend5(channels[k] + deltas[k]);
+            }
+        } else {
+            for (int k = 0; k < 3; k++) {
+                base[0][k] = extend4(block[k] >> 4);
+                base[1][k] = extend4(block[k] & 15);
+            }
+        }
+
+        // ETC1: iki alt blok, her biri kendi taban rengi ve değiştirici tablosuyla
+        bool flip = (high & 1) != 0;
+        int tables[2] = { block[3] >> 5, (block[3] >> 2) & 7 };
+        for (int y = 0; y < 4; y++) {
+            for (int x = 0; x < 4; x++) {
+                int sub = flip ? (y >= 2) : (x >= 2);
+                int index = pixelIndex(x, y);
+                int modifier = modifiers[tables[sub]][index & 1];
+                if (index & 2) {
+                    modifier = -modifier;
+                }
+                store(x, y, base[sub][0] + modifier, base[sub][1] + modifier, base[sub][2] + modifier);
+            }
+        }
+    }
+
+    // RGBA8 seviyesinden 2x2 kutu süzgeciyle bir sonraki seviye
+    std::vector<unsigned char> downsampleRGBA(const std::vector<unsigned char>& source, int width, int height) {
+        int newWidth = std::max(1, width / 2), newHeight = std::max(1, height / 2);
+        std::vector<unsigned char> result((size_t)newWidth * newHeight * 4);
+        for (int y = 0; y < newHeight; y++) {
+            for (int x = 0; x < newWidth; x++) {
+                int x0 = std::min(x * 2, width - 1), x1 = std::min(x * 2 + 1, width - 1);
+                int y0 = std::min(y * 2, height - 1), y1 = std::min(y * 2 + 1, height - 1);
+                for (int k = 0; k < 4; k++) {
+                    int sum = source[((size_t)y0 * width + x0) * 4 + k] + source[((size_t)y0 * width + x1) * 4 + k] +
+                              source[((size_t)y1 * width + x0) * 4 + k] + source[((size_t)y1 * width + x1) * 4 + k];
+                    result[((size_t)y * newWidth + x) * 4 + k] = (unsigned char)((sum + 2) / 4);
+                }
+            }
+        }
+        return result;
+    }
+
+    inline uint16_t pack565(const unsigned char* rgba) {
+        return (uint16_t)(((rgba[0] >> 3) << 11) | ((rgba[1] >> 2) << 5) | (rgba[2] >> 3));
+    }
+
+    // Basit BC1 sıkıştırıcı - uç noktalar en parlak ve en koyu piksel, indeksler en yakın palet rengi
+    void encodeBC1Block(const unsigned char* pixels, unsigned char* block) {
+        int brightest = 0, darkest = 0;
+        int maxLuma = -1, minLuma = 1 << 30;
+        for (int i = 0; i < 16; i++) {
+            int luma = pixels[i * 4] * 2 + pixels[i * 4 + 1] * 4 + pixels[i * 4 + 2];
+            if (luma > maxLuma) {
+                maxLuma = luma;
+                brightest = i;
+            }
+            if (luma < minLuma) {
+                minLuma = luma;
+                darkest = i;
+            }
+        }
+
+        uint16_t c0 = pack565(pixels + brightest * 4);
+        uint16_t c1 = pack565(pixels + darkest * 4);
+        if (c0 < c1) {
+            std::swap(c0, c1);
+        }
+        block[0] = (unsigned char)(c0 & 0xff);
+        block[1] = (unsigned char)(c0 >> 8);
+        block[2] = (unsigned char)(c1 & 0xff);
+        block[3] = (unsigned char)(c1 >> 8);
+
+        // c0 == c1 ise tüm pikseller ilk renk (üç renkli kipe düşmesin diye indeks 0)
+        uint32_t indices = 0;
+        if (c0 != c1) {
+            // Çözücüyle aynı dört renkli palet
+            unsigned char colors[4][3];
+            unsigned char endpoints[2][4];
+            expand565(c0, endpoints[0]);
+            expand565(c1, endpoints[1]);
+            for (int k = 0; k < 3; k++) {
+                colors[0][k] = endpoints[0][k];
+                colors[1][k] = endpoints[1][k];
+                colors[2][k] = (unsigned char)((2 * endpoints[0][k] + endpoints[1][k]) / 3);
+                colors[3][k] = (unsigned char)((endpoints[0][k] + 2 * endpoints[1][k]) / 3);
+            }
+            for (int i = 0; i < 16; i++) {
+                int best = 0, bestDistance = 1 << 30;
+                for (int c = 0; c < 4; c++) {
+                    int distance = 0;
+                    for (int k = 0; k < 3; k++) {
+                        int d = pixels[i * 4 + k] - colors[c][k];
+                        distance += d * d;
+                    }
+                    if (distance < bestDistance) {
+                        bestDistance = distance;
+                        best = c;
+                    }
+                }
+                indices |= (uint32_t)best << (2 * i);
+            }
+        }
+        block[4] = (unsigned char)(indices & 0xff);
+        block[5] = (unsigned char)((indices >> 8) & 0xff);
+        block[6] = (unsigned char)((indices >> 16) & 0xff);
+        block[7] = (unsigned char)(indices >> 24);
+    }
+
+    std::vector<unsigned char> encodeBC1(const std::vector<unsigned char>& rgba, int width, int height) {
+        int blocksX = (width + 3) / 4, blocksY = (height + 3) / 4;
+        std::vector<unsigned char> result((size_t)blocksX * blocksY * 8);
+        unsigned char pixels[16 * 4];
+        for (int by = 0; by < blocksY; by++) {
+            for (int bx = 0; bx < blocksX; bx++) {
+                // Kenardaki eksik pikseller son satır/sütunla doldurulur
+                for (int y = 0; y < 4; y++) {
+                    for (int x = 0; x < 4; x++) {
+                        int sx = std::min(bx * 4 + x, width - 1), sy = std::min(by * 4 + y, height - 1);
+                        std::memcpy(pixels + (y * 4 + x) * 4, &rgba[((size_t)sy * width + sx) * 4], 4);
+                    }
+                }
+                encodeBC1Block(pixels, &result[((size_t)by * blocksX + bx) * 8]);
+            }
+        }
+        return result;
+    }
+}
+
+bool loadTextureFile(const std::string& path, TextureData& out) {
+    std::vector<unsigned char> bytes;
+    if (!readFileBytes(path, bytes)) {
+        return false;
+    }
+
+    static const unsigned char ktx2Identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+    if (bytes.size() >= 12 && std::memcmp(bytes.data(), ktx2Identifier, 12) == 0) {
+        return parseKTX2(bytes, path, out);
+    }
+    if (bytes.size() >= 4 && std::memcmp(bytes.data(), "DDS ", 4) == 0) {
+        return parseDDS(bytes, path, out);
+    }
+    std::cerr << "HATA: Tanınmayan doku dosyası (KTX2 ya da DDS değil): " << path << std::endl;
+    return false;
+}
+
+bool decodeToRGBA8(TextureData& texture) {
+    if (!isBlockCompressed(texture.format)) {
+        return true;
+    }
+    if (texture.format == TextureFormat::BC7) {
+        return false;
+    }
+
+    for (int level = 0; level < texture.levelCount(); level++) {
+        int width = texture.levelWidth(level), height = texture.levelHeight(level);
+        int blocksX = (width + 3) / 4, blocksY = (height + 3) / 4;
+        size_t blockSize = textureLevelSize(texture.format, 4, 4);
+        const std::vector<unsigned char>& source = texture.levels[level];
+        std::vector<unsigned char> decoded((size_t)width * height * 4);
+
+        unsigned char pixels[16 * 4];
+        for (int by = 0; by < blocksY; by++) {
+            for (int bx = 0; bx < blocksX; bx++) {
+                const unsigned char* block = &source[((size_t)by * blocksX + bx) * blockSize];
+                switch (texture.format) {
+                    case TextureFormat::BC1:
+                        decodeBC1Block(block, pixels, false);
+                        break;
+                    case TextureFormat::BC3:
+                        decodeBC1Block(block + 8, pixels, true);
+                        decodeBC4Block(block, pixels, 3);
+                        break;
+                    case TextureFormat::BC4:
+                        // GPU yolundaki gibi tek kanal griye yayılır
+                        decodeBC4Block(block, pixels, 0);
+                        for (int i = 0; i < 16; i++) {
+                            pixels[i * 4 + 1] = pixels[i * 4 + 2] = pixels[i * 4];
+                            pixels[i * 4 + 3] = 255;
+                        }
+                        break;
+                    case TextureFormat::BC5:
+                        decodeBC4Block(block, pixels, 0);
+                        decodeBC4Block(block + 8, pixels, 1);
+                        for (int i = 0; i < 16; i++) {
+                            pixels[i * 4 + 2] = 0;
+                            pixels[i * 4 + 3] = 255;
+                        }
+                        break;
+                    case TextureFormat::ETC2_RGB8:
+                        decodeETC2Block(block, pixels);
+                        break;
+                    default:
+                        return false;
+                }
+
+                // Kenar bloklarında doku dışına taşan pikseller atılır
+                for (int y = 0; y < 4 && by * 4 + y < height; y++) {
+                    for (int x = 0; x < 4 && bx * 4 + x < width; x++) {
+                        std::memcpy(&decoded[((size_t)(by * 4 + y) * width + bx * 4 + x) * 4], pixels + (y * 4 + x) * 4, 4);
+                    }
+                }
+            }
+        }
+        texture.levels[level].swap(decoded);
+    }
+    texture.format = TextureFormat::RGBA8;
+    return true;
+}
+
+TextureData generateProceduralTexture(unsigned int index, int size) {
+    // Kenar uzunluğu 2'nin kuvvetine yuvarlanır - mip zinciri 1x1'e kadar iner
+    int edge = 4;
+    while (edge < size) {
+        edge *= 2;
+    }
+
+    static const unsigned char tints[8][3] = {
+        { 230, 90, 60 }, { 80, 170, 230 }, { 240, 200, 80 }, { 120, 210, 110 },
+        { 200, 120, 220 }, { 90, 220, 200 }, { 240, 150, 170 }, { 180, 180, 190 }
+    };
+    const unsigned char* tint = tints[index % 8];
+    unsigned int pattern = (index / 8 + index) % 4;
+
+    std::vector<unsigned char> rgba((size_t)edge * edge * 4);
+    for (int y = 0; y < edge; y++) {
+        for (int x = 0; x < edge; x++) {
+            float u = (float)x / edge, v = (float)y / edge;
+            float shade = 1.0f;
+            if (pattern == 0) {
+                // Dama tahtası
+                shade = (((int)(u * 8) + (int)(v * 8)) & 1) ? 1.0f : 0.45f;
+            } else if (pattern == 1) {
+                // Tuğla - her iki sırada yarım tuğla kaydırılır, harç çizgileri koyu
+                int row = (int)(v * 16);
+                float brick = u * 8 + ((row & 1) ? 0.5f : 0.0f);
+                bool mortar = std::fmod(v * 16, 1.0f) < 0.08f || std::fmod(brick, 1.0f) < 0.04f;
+                shade = mortar ? 0.3f : 0.75f + 0.25f * (float)((row * 7 + (int)brick * 13) % 5) / 4.0f;
+            } else if (pattern == 2) {
+                // Eş merkezli halkalar
+                float dx = u - 0.5f, dy = v - 0.5f;
+                shade = 0.6f + 0.4f * std::cos(std::sqrt(dx * dx + dy * dy) * 80.0f);
+            } else {
+                // Çapraz şeritler
+                shade = std::fmod(u + v, 0.125f) < 0.0625f ? 1.0f : 0.5f;
+            }
+
+            // 32 texel'lik ince ızgara - yakın çekimde en ince seviyenin yüklendiği görülür
+            if (x % 32 == 0 || y % 32 == 0) {
+                shade *= 0.6f;
+            }
+
+            unsigned char* pixel = &rgba[((size_t)y * edge + x) * 4];
+            for (int k = 0; k < 3; k++) {
+                pixel[k] = (unsigned char)std::min(255.0f, tint[k] * shade);
+            }
+            pixel[3] = 255;
+        }
+    }
+
+    TextureData texture;
+    texture.format = TextureFormat::BC1;
+    texture.width = edge;
+    texture.height = edge;
+    int width = edge;
+    while (true) {
+        texture.levels.push_back(encodeBC1(rgba, width, width));
+        if (width == 1) {
+            break;
+        }
+        rgba = downsampleRGBA(rgba, width, width);
+        width /= 2;
+    }
+    return texture;
+}
@@ -0,0 +1,56 @@
+#ifndef TEXTURE_FORMATS_H
+#define TEXTURE_FORMATS_H
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Desteklenen doku biçimleri - RGBA8 dışındakiler 4x4 bloklarla sıkıştırılmıştır
+enum class TextureFormat {
+    RGBA8,
+    BC1,      // DXT1 - RGB + 1 bit alfa, blok başına 8 bayt
+    BC3,      // DXT5 - RGBA, blok başına 16 bayt
+    BC4,      // Tek kanal, blok başına 8 bayt
+    BC5,      // İki kanal, blok başına 16 bayt
+    BC7,      // Yüksek kaliteli RGBA, blok başına 16 bayt (CPU çözücüsü yok)
+    ETC2_RGB8 // ETC1 ile geriye uyumlu, blok başına 8 bayt
+};
+
+const char* textureFormatName(TextureFormat format);
+bool isBlockCompressed(TextureFormat format);
+
+// Sıkıştırılmış biçimler için GL iç biçimi; RGBA8 için GL_RGBA8
+GLenum textureFormatGLEnum(TextureFormat format);
+
+// Bir mip seviyesinin bayt boyutu (blok biçimlerinde 4'e yuvarlanmış boyutlarla)
+size_t textureLevelSize(TextureFormat format, int width, int height);
+
+// Sistem belleğindeki doku - levels[0] en büyük seviye
+struct TextureData {
+    TextureFormat format = TextureFormat::RGBA8;
+    int width = 0;
+    int height = 0;
+    std::vector<std::vector<unsigned char>> levels;
+
+    int levelCount() const { return static_cast<int>(levels.size()); }
+    int levelWidth(int level) const { return width >> level > 0 ? width >> level : 1; }
+    int levelHeight(int level) const { return height >> level > 0 ? height >> level : 1; }
+
+    // firstLevel ve daha kaba seviyelerin toplam boyutu
+    size_t bytesFrom(int firstLevel) const;
+};
+
+// DDS (DX9 FourCC ya da DX10 başlığı) ve KTX2 (süper sıkıştırmasız) dosyalarını okur
+// Biçim dosya imzasından anlaşılır; hata durumunda mesaj yazdırır ve false döner
+bool loadTextureFile(const std::string& path, TextureData& out);
+
+// Sıkıştırılmış dokuyu CPU'da RGBA8'e çözer (sürücü biçimi desteklemiyorsa)
+// BC7 için çözücü yok - false döner
+bool decodeToRGBA8(TextureData& texture);
+
+// Dosya yokken kullanılan prosedürel doku: RGBA8 desen ve mip zinciri üretilip BC1'e sıkıştırılır,
+// böylece akış dosyadan okunan sıkıştırılmış dokularla aynı yoldan geçer
+TextureData generateProceduralTexture(unsigned int index, int size);
+
+#endif // TEXTURE_FORMATS_H
@@ -0,0 +1,444 @@
+#include "texture_streaming.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+
+#include "matrix_utils.h"
+
+bool CompressedFormatSupport::supports(TextureFormat format) const {
+    switch (format) {
+        case TextureFormat::RGBA8: return true;
+        case TextureFormat::BC1:
+        case TextureFormat::BC3: return s3tc;
+        case TextureFormat::BC4:
+        case TextureFormat::BC5: return rgtc;
+        case TextureFormat::BC7: return bptc;
+        case TextureFormat::ETC2_RGB8: return etc2;
+    }
+    return false;
+}
+
+CompressedFormatSupport queryCompressedFormatSupport() {
+    CompressedFormatSupport support;
+    GLint major = 0, minor = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &major);
+    glGetIntegerv(GL_MINOR_VERSION, &minor);
+    int version = major * 10 + minor;
+    support.bptc = version >= 42;
+    support.etc2 = version >= 43;
+
+    GLint extensionCount = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+    for (GLint i = 0; i < extensionCount; i++) {
+        const char* name = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+        if (name == NULL) {
+            continue;
+        }
+        if (std::strcmp(name, "GL_EXT_texture_compression_s3tc") == 0) {
+            support.s3tc = true;
+        } else if (std::strcmp(name, "GL_ARB_texture_compression_bptc") == 0) {
+            support.bptc = true;
+        } else if (std::strcmp(name, "GL_ARB_ES3_compatibility") == 0) {
+            support.etc2 = true;
+        }
+    }
+    return support;
+}
+
+void TextureStreamer::init(unsigned int workerCount) {
+    support = queryCompressedFormatSupport();
+    std::cout << "Sıkıştırılmış doku desteği: BC1/BC3 " << (support.s3tc ? "var" : "yok")
+              << ", BC7 " << (support.bptc ? "var" : "yok") << ", ETC2 " << (support.etc2 ? "var" : "yok")
+              << " (desteklenmeyenler CPU'da çözülür)" << std::endl;
+
+    stopping = false;
+    if (synchronous) {
+        return;
+    }
+    workerCount = std::max(1u, workerCount);
+    for (unsigned int i = 0; i < workerCount; i++) {
+        workers.emplace_back(&TextureStreamer::workerLoop, this);
+    }
+}
+
+unsigned int TextureStreamer::addFile(const std::string& path) {
+    std::unique_ptr<Entry> entry(new Entry());
+    entry->path = path;
+    return enqueue(std::move(entry));
+}
+
+unsigned int TextureStreamer::addProcedural(unsigned int seed, int size) {
+    std::unique_ptr<Entry> entry(new Entry());
+    entry->seed = seed;
+    entry->proceduralSize = size;
+    return enqueue(std::move(entry));
+}
+
+std::vector<unsigned int> TextureStreamer::addDirectory(const std::string& directory) {
+    std::vector<std::string> paths;
+    std::error_code error;
+    for (const std::filesystem::directory_entry& file : std::filesystem::directory_iterator(directory, error)) {
+        std::string extension = file.path().extension().string();
+        // tolower'a negatif char vermek tanımsız - Türkçe karakterli yollar UTF-8 baytları içerir
+        std::transform(extension.begin(), extension.end(), extension.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        if (file.is_regular_file() && (extension == ".ktx2" || extension == ".dds")) {
+            paths.push_back(file.path().string());
+        }
+    }
+    if (error) {
+        std::cerr << "HATA: Doku dizini okunamadı: " << directory << std::endl;
+    }
+
+    std::sort(paths.begin(), paths.end());
+    std::vector<unsigned int> textures;
+    for (const std::string& path : paths) {
+        textures.push_back(addFile(path));
+    }
+    return textures;
+}
+
+unsigned int TextureStreamer::enqueue(std::unique_ptr<Entry> entry) {
+    // Girdiler unique_ptr ile tutulur - vektör büyürken yükleyicilerin elindeki işaretçiler geçerli kalır
+    Entry* job = entry.get();
+    entries.push_back(std::move(entry));
+
+    // Eşzamanlı modda doku hemen yüklenir - hangi karede hazır olacağı zamanlamaya bağlı kalmaz
+    if (synchronous) {
+        load(*job);
+        return static_cast<unsigned int>(entries.size() - 1);
+    }
+    {
+        std::lock_guard<std::mutex> lock(jobMutex);
+        jobs.push_back(job);
+    }
+    jobReady.notify_one();
+    return static_cast<unsigned int>(entries.size() - 1);
+}
+
+void TextureStreamer::workerLoop() {
+    while (true) {
+        Entry* entry = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(jobMutex);
+            jobReady.wait(lock, [this]() { return stopping || !jobs.empty(); });
+            if (stopping) {
+                return;
+            }
+            entry = jobs.front();
+            jobs.pop_front();
+        }
+        load(*entry);
+    }
+}
+
+void TextureStreamer::load(Entry& entry) const {
+    bool ok = true;
+    if (entry.path.empty()) {
+        entry.data = generateProceduralTexture(entry.seed, entry.proceduralSize);
+    } else {
+        ok = loadTextureFile(entry.path, entry.data);
+    }
+
+    // Sürücünün tanımadığı biçimler burada, GL iş parçacığını bekletmeden çözülür
+    if (ok && !support.supports(entry.data.format)) {
+        TextureFormat original = entry.data.format;
+        if (!decodeToRGBA8(entry.data)) {
+            std::cerr << "HATA: " << textureFormatName(original) << " sürücüde desteklenmiyor ve CPU çözücüsü yok: "
+                      << entry.path << std::endl;
+            ok = false;
+        }
+    }
+    if (ok && entry.data.levelCount() == 0) {
+        ok = false;
+    }
+
+    if (ok) {
+        entry.tailLevel = entry.data.levelCount() - 1;
+        for (int level = 0; level < entry.data.levelCount(); level++) {
+            if (std::max(entry.data.levelWidth(level), entry.data.levelHeight(level)) <= TEXTURE_TAIL_SIZE) {
+                entry.tailLevel = level;
+                break;
+            }
+        }
+    }
+    entry.failed = !ok;
+    entry.ready.store(true, std::memory_order_release);
+}
+
+void TextureStreamer::request(unsigned int texture, float pixels) {
+    Entry& entry = *entries[texture];
+    entry.lastUsedFrame = frameNumber;
+    if (!entry.ready.load(std::memory_order_acquire) || entry.failed) {
+        return;
+    }
+
+    // Bir texel bir pikselden küçük kalmayacak en kaba seviye
+    int size = std::max(entry.data.width, entry.data.height);
+    int level = pixels > 0.0f ? (int)std::floor(std::log2((float)size / pixels)) : entry.tailLevel;
+    level = std::max(0, std::min(level, entry.tailLevel));
+    entry.requestedLevel = entry.requested ? std::min(entry.requestedLevel, level) : level;
+    entry.requested = true;
+}
+
+void TextureStreamer::setResidentLevel(Entry& entry, int level) {
+    const TextureData& data = entry.data;
+    GLenum internalFormat = textureFormatGLEnum(data.format);
+
+    unsigned int texture;
+    glGenTextures(1, &texture);
+    glActiveTexture(GL_TEXTURE0 + ALBEDO_TEXTURE_UNIT);
+    glBindTexture(GL_TEXTURE_2D, texture);
+
+    // Yerleşik seviyeler yeni dokunun 0. seviyesinden başlar - yalnızca onlar VRAM'de yer tutar
+    size_t bytes = 0;
+    for (int source = level; source < data.levelCount(); source++) {
+        const std::vector<unsigned char>& pixels = data.levels[source];
+        int width = data.levelWidth(source), height = data.levelHeight(source);
+        if (isBlockCompressed(data.format)) {
+            glCompressedTexImage2D(GL_TEXTURE_2D, source - level, internalFormat, width, height, 0,
+                                   static_cast<GLsizei>(pixels.size()), pixels.data());
+        } else {
+            glTexImage2D(GL_TEXTURE_2D, source - level, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+        }
+        bytes += pixels.size();
+    }
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, data.levelCount() - 1 - level);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+    // BC4 tek kanallı - gri görünmesi için yeşil ve mavi de kırmızıyı okur
+    if (data.format == TextureFormat::BC4) {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_G, GL_RED);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_B, GL_RED);
+    }
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glActiveTexture(GL_TEXTURE0);
+
+    if (entry.texture != 0) {
+        glDeleteTextures(1, &entry.texture);
+    }
+    residentBytes = residentBytes - entry.residentBytes + bytes;
+    entry.texture = texture;
+    entry.residentLevel = level;
+    entry.residentBytes = bytes;
+    frameUploadBytes += bytes;
+    uploadedBytes += bytes;
+}
+
+bool TextureStreamer::makeRoom(size_t extraBytes, const Entry* keep) {
+    while (residentBytes + extraBytes > budgetBytes) {
+        // En uzun süredir kullanılmayan doku - bu karede kullanılanlar yalnızca istenenden fazlasını bırakır
+        Entry* victim = nullptr;
+        int victimLevel = 0;
+        for (const std::unique_ptr<Entry>& candidate : entries) {
+            Entry& entry = *candidate;
+            if (&entry == keep || entry.residentLevel < 0) {
+                continue;
+            }
+            bool usedNow = entry.requested && entry.lastUsedFrame == frameNumber;
+            int floorLevel = usedNow ? entry.requestedLevel : entry.tailLevel;
+            if (entry.residentLevel >= floorLevel) {
+                continue;
+            }
+            if (victim == nullptr || entry.lastUsedFrame < victim->lastUsedFrame ||
+                (entry.lastUsedFrame == victim->lastUsedFrame && entry.residentBytes > victim->residentBytes)) {
+                victim = &entry;
+                victimLevel = floorLevel;
+            }
+        }
+
+        if (victim == nullptr) {
+            return false;
+        }
+        setResidentLevel(*victim, victimLevel);
+        evictions++;
+    }
+    return true;
+}
+
+void TextureStreamer::update() {
+    auto start = std::chrono::steady_clock::now();
+    frameUploadBytes = 0;
+
+    // Yeni yüklenen dokuların kaba seviyeleri hemen GPU'ya alınır - küçük oldukları için bütçeye takılmazlar
+    std::vector<Entry*> upgrades;
+    for (const std::unique_ptr<Entry>& candidate : entries) {
+        Entry& entry = *candidate;
+        if (!entry.ready.load(std::memory_order_acquire) || entry.failed) {
+            continue;
+        }
+        if (entry.residentLevel < 0) {
+            setResidentLevel(entry, entry.tailLevel);
+        }
+        if (entry.requested && entry.requestedLevel < entry.residentLevel) {
+            upgrades.push_back(&entry);
+        }
+    }
+
+    // En çok eksiği olan doku önce - her doku bu karede en fazla bir seviye iner (önce kaba seviyeler)
+    std::sort(upgrades.begin(), upgrades.end(), [](const Entry* a, const Entry* b) {
+        return a->residentLevel - a->requestedLevel > b->residentLevel - b->requestedLevel;
+    });
+    for (Entry* entry : upgrades) {
+        int level = entry->residentLevel - 1;
+        size_t cost = entry->data.bytesFrom(level);
+        if (frameUploadBytes > 0 && frameUploadBytes + cost > uploadBytesPerFrame) {
+            break;
+        }
+        if (!makeRoom(entry->data.levels[level].size(), entry)) {
+            continue;
+        }
+        setResidentLevel(*entry, level);
+    }
+
+    for (const std::unique_ptr<Entry>& entry : entries) {
+        entry->requested = false;
+    }
+
+    auto stop = std::chrono::steady_clock::now();
+    uploadMs += std::chrono::duration<double, std::milli>(stop - start).count();
+    frames++;
+    frameNumber++;
+}
+
+bool TextureStreamer::bind(unsigned int texture) const {
+    const Entry& entry = *entries[texture];
+    if (entry.texture == 0) {
+        return false;
+    }
+    glActiveTexture(GL_TEXTURE0 + ALBEDO_TEXTURE_UNIT);
+    glBindTexture(GL_TEXTURE_2D, entry.texture);
+    glActiveTexture(GL_TEXTURE0);
+    return true;
+}
+
+unsigned int TextureStreamer::pendingLoads() const {
+    unsigned int pending = 0;
+    for (const std::unique_ptr<Entry>& entry : entries) {
+        if (!entry->ready.load(std::memory_order_acquire)) {
+            pending++;
+        }
+    }
+    return pending;
+}
+
+void TextureStreamer::resetStats() {
+    uploadedBytes = 0;
+    uploadMs = 0.0;
+    evictions = 0;
+    frames = 0;
+}
+
+void TextureStreamer::destroy() {
+    {
+        std::lock_guard<std::mutex> lock(jobMutex);
+        stopping = true;
+        jobs.clear();
+    }
+    jobReady.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+
+    for (const std::unique_ptr<Entry>& entry : entries) {
+        if (entry->texture != 0) {
+            glDeleteTextures(1, &entry->texture);
+        }
+    }
+    entries.clear();
+    residentBytes = 0;
+}
+
+void TexturedCubes::init(unsigned int vbo, unsigned int ebo) {
+    cubeVBO = vbo;
+    cubeEBO = ebo;
+}
+
+void TexturedCubes::setInstances(const std::vector<CubeInstance>& instances, const std::vector<unsigned int>& textures) {
+    destroy();
+    if (textures.empty()) {
+        return;
+    }
+
+    groups.resize(textures.size());
+    for (size_t i = 0; i < textures.size(); i++) {
+        groups[i].texture = textures[i];
+    }
+    for (size_t i = 0; i < instances.size(); i++) {
+        groups[i % textures.size()].instances.push_back(instances[i]);
+    }
+    for (Group& group : groups) {
+        group.batch.create(cubeVBO, cubeEBO);
+        group.batch.upload(group.instances.data(), static_cast<unsigned int>(group.instances.size()));
+    }
+}
+
+void TexturedCubes::requestMips(TextureStreamer& streamer, const float* viewProjection, const float* cameraPosition,
+                                float fov, int screenHeight) const {
+    float planes[6][4];
+    MatrixUtils::extractFrustumPlanes(planes, viewProjection);
+
+    // Birim uzaklıktaki bir birimlik nesnenin piksel boyu
+    float pixelsPerUnit = screenHeight / (2.0f * std::tan(fov * 0.5f));
+
+    for (const Group& group : groups) {
+        for (const CubeInstance& instance : group.instances) {
+            // Küpü çevreleyen küre kesik piramidin dışındaysa istek yapılmaz
+            float radius = instance.scale * 0.8660254f;
+            bool visible = true;
+            for (int p = 0; p < 6 && visible; p++) {
+                visible = planes[p][0] * instance.offset[0] + planes[p][1] * instance.offset[1] +
+                          planes[p][2] * instance.offset[2] + planes[p][3] >= -radius;
+            }
+            if (!visible) {
+                continue;
+            }
+
+            // Her yüz dokuyu bir kez kaplar - dokunun ekran boyu yüzün ekran boyudur
+            float dx = instance.offset[0] - cameraPosition[0];
+            float dy = instance.offset[1] - cameraPosition[1];
+            float dz = instance.offset[2] - cameraPosition[2];
+            float distance = std::max(std::sqrt(dx * dx + dy * dy + dz * dz), 0.1f);
+            streamer.request(group.texture, instance.scale * pixelsPerUnit / distance);
+        }
+    }
+}
+
+void TexturedCubes::draw(const TextureStreamer& streamer, bool textured) const {
+    for (const Group& group : groups) {
+        if (streamer.isResident(group.texture) != textured) {
+            continue;
+        }
+        if (textured) {
+            streamer.bind(group.texture);
+        }
+        group.batch.draw();
+    }
+}
+
+unsigned int TexturedCubes::instanceCount() const {
+    unsigned int count = 0;
+    for (const Group& group : groups) {
+        count += group.batch.count;
+    }
+    return count;
+}
+
+void TexturedCubes::destroy() {
+    for (Group& group : groups) {
+        group.batch.destroy();
+    }
+    groups.clear();
+}
@@ -0,0 +1,155 @@
+#ifndef TEXTURE_STREAMING_H
+#define TEXTURE_STREAMING_H
+
+#include <glad/glad.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "scene.h"
+#include "texture_formats.h"
+#include "texture_units.h"
+
+// Her zaman yerleşik tutulan kaba seviyelerin en büyük kenarı - doku hiç boş görünmez
+const int TEXTURE_TAIL_SIZE = 64;
+
+// Sürücünün doğrudan kabul ettiği sıkıştırılmış biçimler - desteklenmeyenler yükleme sırasında RGBA8'e çözülür
+struct CompressedFormatSupport {
+    bool s3tc = false; // BC1/BC3 - GL_EXT_texture_compression_s3tc
+    bool rgtc = true;  // BC4/BC5 - GL 3.0 çekirdeği
+    bool bptc = false; // BC7 - GL 4.2 ya da GL_ARB_texture_compression_bptc
+    bool etc2 = false; // ETC2 - GL 4.3 ya da GL_ARB_ES3_compatibility
+
+    bool supports(TextureFormat format) const;
+};
+
+// Mevcut context'in sürüm ve uzantılarından desteği belirler (GL iş parçacığında çağrılmalı)
+CompressedFormatSupport queryCompressedFormatSupport();
+
+// Doku akışı - dosya okuma, üretim ve CPU çözümü arka plan iş parçacıklarında yapılır;
+// her doku yalnızca ekran boyutunun gerektirdiği mip seviyelerini GPU'da tutar.
+// Yükseltmeler kare başına yükleme bütçesiyle sınırlıdır, VRAM bütçesi aşılırsa
+// en uzun süredir kullanılmayan dokular (LRU) kaba seviyelerine düşürülür
+class TextureStreamer {
+public:
+    size_t budgetBytes = 8u << 20;         // Yerleşik seviyeler için VRAM bütçesi
+    size_t uploadBytesPerFrame = 1u << 20; // Kare başına en fazla yükleme (en az bir yükseltme yapılır)
+    bool synchronous = false;              // Dokular eklenirken çağıran iş parçacığında yüklenir (init'ten önce ayarlanmalı)
+
+    // İstatistikler - resetStats() ile sıfırlanana kadar birikir
+    size_t residentBytes = 0;
+    size_t uploadedBytes = 0;
+    double uploadMs = 0.0;       // Yükleme çağrılarının CPU süresi
+    unsigned int evictions = 0;
+    unsigned int frames = 0;
+
+    // Yükleyici iş parçacıklarını başlatır (eşzamanlı modda başlatılmaz); desteklenen biçimler bu context'ten sorgulanır
+    void init(unsigned int workerCount);
+
+    // Dokuyu yükleme kuyruğuna ekler ve tanıtıcısını döndürür
+    unsigned int addFile(const std::string& path);
+    unsigned int addProcedural(unsigned int seed, int size);
+
+    // Dizindeki .ktx2 ve .dds dosyalarını ada göre sıralı ekler
+    std::vector<unsigned int> addDirectory(const std::string& directory);
+
+    // Bu karede dokunun ekranda yaklaşık pixels piksel genişliğinde görüneceğini bildirir;
+    // aynı dokuyu kullanan çizimlerden en büyüğü esas alınır
+    void request(unsigned int texture, float pixels);
+
+    // Yüklenen dokuları GPU'ya alır, istenen seviyelere yaklaştırır ve bütçeyi uygular (GL iş parçacığı)
+    void update();
+
+    // Dokuyu ALBEDO_TEXTURE_UNIT'e bağlar; henüz hiç seviyesi yoksa false döner
+    bool bind(unsigned int texture) const;
+
+    // Dokunun en az bir seviyesi GPU'da mı
+    bool isResident(unsigned int texture) const { return entries[texture]->texture != 0; }
+
+    unsigned int textureCount() const { return static_cast<unsigned int>(entries.size()); }
+    unsigned int pendingLoads() const;
+    void resetStats();
+
+    void destroy();
+
+private:
+    struct Entry {
+        // Yükleyici iş parçacığı doldurur; ready true olduktan sonra yalnızca GL iş parçacığı dokunur
+        std::string path;          // Boşsa prosedürel
+        unsigned int seed = 0;
+        int proceduralSize = 0;
+        TextureData data;
+        bool failed = false;
+        std::atomic<bool> ready{ false };
+
+        unsigned int texture = 0;   // GL nesnesi - yalnızca yerleşik seviyeleri içerir
+        int residentLevel = -1;     // Yerleşik en ince seviye (-1: hiç yok)
+        int tailLevel = 0;          // Her zaman yerleşik tutulan ilk kaba seviye
+        int requestedLevel = 0;     // Bu karede istenen en ince seviye
+        bool requested = false;
+        uint64_t lastUsedFrame = 0;
+        size_t residentBytes = 0;
+    };
+
+    std::vector<std::unique_ptr<Entry>> entries;
+    CompressedFormatSupport support;
+    uint64_t frameNumber = 0;
+    size_t frameUploadBytes = 0;
+
+    // Yükleyici havuzu
+    std::vector<std::thread> workers;
+    std::deque<Entry*> jobs;
+    std::mutex jobMutex;
+    std::condition_variable jobReady;
+    bool stopping = false;
+
+    unsigned int enqueue(std::unique_ptr<Entry> entry);
+    void workerLoop();
+    void load(Entry& entry) const;
+
+    // Dokuyu [level, son] seviyeleriyle sistem belleğindeki kopyadan yeniden oluşturur
+    void setResidentLevel(Entry& entry, int level);
+
+    // Bütçeye extraBytes yer açmak için LRU dokuları düşürür; açılamazsa false
+    bool makeRoom(size_t extraBytes, const Entry* keep);
+};
+
+// Doku kaplanmış küpler - küpler dokularına göre gruplanır, her grup tek örneklenmiş çizimdir
+class TexturedCubes {
+public:
+    void init(unsigned int cubeVBO, unsigned int cubeEBO);
+
+    // i. küp textures[i % textures.size()] dokusunu kullanır
+    void setInstances(const std::vector<CubeInstance>& instances, const std::vector<unsigned int>& textures);
+
+    // Görünen küplerin ekran boyutundan gereken mip seviyelerini akışa bildirir
+    void requestMips(TextureStreamer& streamer, const float* viewProjection, const float* cameraPosition,
+                     float fov, int screenHeight) const;
+
+    // Dokusu yerleşik olan (textured) ya da henüz gelmemiş (!textured) grupları bağlı shader'la çizer;
+    // iki çağrı ALBEDO_TEXTURE ile ve onsuz derlenmiş permütasyonlarla yapılır
+    void draw(const TextureStreamer& streamer, bool textured) const;
+
+    unsigned int instanceCount() const;
+
+    void destroy();
+
+private:
+    struct Group {
+        unsigned int texture = 0;
+        std::vector<CubeInstance> instances;
+        InstanceBatch batch;
+    };
+
+    std::vector<Group> groups;
+    unsigned int cubeVBO = 0;
+    unsigned int cubeEBO = 0;
+};
+
+#endif // TEXTURE_STREAMING_H
@@ -0,0 +1,13 @@
+#ifndef TEXTURE_UNITS_H
+#define TEXTURE_UNITS_H
+
+// Sahne shader'ı (fragment.glsl) örnekleyicilerinin sabit doku birimleri - her modül yalnızca kendi
+// birimine bağlar, setLightingTextureUnits örnekleyicileri programa bir kez atar.
+// 0-3 geçişlerin kendi ara dokularına (Hi-Z, OIT birleştirme) bırakılır
+const int SHADOW_TEXTURE_UNIT = 4;       // Gölge dokusu dizisi
+const int CLUSTER_GRID_TEXTURE_UNIT = 5; // Küme ızgarası (buffer dokusu)
+const int LIGHT_INDEX_TEXTURE_UNIT = 6;  // Kümelerin ışık indeksleri (buffer dokusu)
+const int LIGHT_DATA_TEXTURE_UNIT = 7;   // Nokta ışık verisi (buffer dokusu)
+const int ALBEDO_TEXTURE_UNIT = 8;       // Akıtılan renk dokusu
+
+#endif // TEXTURE_UNITS_H
@@ -0,0 +1,348 @@
+#include "transparency.h"
+
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+#include "parallel.h"
+#include "shader_permutations.h"
+
+const char* transparencyModeName(TransparencyMode mode) {
+    switch (mode) {
+        case TransparencyMode::Off: return "kapalı";
+        case TransparencyMode::WeightedOIT: return "ağırlıklı OIT";
+        case TransparencyMode::SortedCPU: return "CPU sıralı";
+    }
+    return "?";
+}
+
+void parallelRadixSort(std::vector<uint32_t>& keys, std::vector<uint32_t>& values, unsigned int threadCount) {
+    const size_t count = keys.size();
+    if (count < 2) {
+        return;
+    }
+
+    // Küçük dizilerde iş parçacığı açmak sıralamadan pahalı
+    if (count < 8192) {
+        threadCount = 1;
+    }
+    threadCount = std::max(1u, std::min<unsigned int>(threadCount, static_cast<unsigned int>(count)));
+
+    std::vector<uint32_t> tempKeys(count);
+    std::vector<uint32_t> tempValues(count);
+    std::vector<size_t> histograms(threadCount * 256);
+
+    std::vector<uint32_t>* srcKeys = &keys;
+    std::vector<uint32_t>* srcValues = &values;
+    std::vector<uint32_t>* dstKeys = &tempKeys;
+    std::vector<uint32_t>* dstValues = &tempValues;
+
+    for (unsigned int shift = 0; shift < 32; shift += 8) {
+        // 1. Her iş parçacığı kendi parçasının basamak histogramını çıkarır
+        std::fill(histograms.begin(), histograms.end(), 0);
+        const uint32_t* inKeys = srcKeys->data();
+        Parallel::forRange(count, threadCount, [&](size_t begin, size_t end, unsigned int t) {
+            size_t* histogram = &histograms[t * 256];
+            for (size_t i = begin; i < end; i++) {
+                histogram[(inKeys[i] >> shift) & 0xFF]++;
+            }
+        });
+
+        // Tüm anahtarlar bu basamakta aynıysa geçişi atla
+        bool trivial = false;
+        for (unsigned int digit = 0; digit < 256 && !trivial; digit++) {
+            size_t total = 0;
+            for (unsigned int t = 0; t < threadCount; t++) {
+                total += histograms[t * 256 + digit];
+            }
+            trivial = (total == count);
+        }
+        if (trivial) {
+            continue;
+        }
+
+        // 2. Önek toplamı - aynı basamak içinde düşük numaralı parça önce gelir (kararlılık)
+        size_t running = 0;
+        for (unsigned int digit = 0; digit < 256; digit++) {
+            for (unsigned int t = 0; t < threadCount; t++) {
+                size_t bucket = histograms[t * 256 + digit];
+                histograms[t * 256 + digit] = running;
+                running += bucket;
+            }
+        }
+
+        // 3. Her iş parçacığı kendi parçasını hesaplanan konumlara dağıtır
+        const uint32_t* inValues = srcValues->data();
+        uint32_t* outKeys = dstKeys->data();
+        uint32_t* outValues = dstValues->data();
+        Parallel::forRange(count, threadCount, [&](size_t begin, size_t end, unsigned int t) {
+            size_t* offsets = &histograms[t * 256];
+            for (size_t i = begin; i < end; i++) {
+                size_t position = offsets[(inKeys[i] >> shift) & 0xFF]++;
+                outKeys[position] = inKeys[i];
+                outValues[position] = inValues[i];
+            }
+        });
+
+        std::swap(srcKeys, dstKeys);
+        std::swap(srcValues, dstValues);
+    }
+
+    // Sonuç geçici tamponda kaldıysa yer değiştir
+    if (srcKeys != &keys) {
+        keys.swap(tempKeys);
+        values.swap(tempValues);
+    }
+}
+
+bool TransparencyRenderer::init(const std::string& shaderDir, unsigned int cubeVBO, unsigned int cubeEBO) {
+    accumShader.reset(new Shader((shaderDir + "vertex.glsl").c_str(), (shaderDir + "oit_fragment.glsl").c_str(),
+                                 shaderFeatureDefines(ShaderFeature::Instancing)));
+    compositeShader.reset(new Shader((shaderDir + "fullscreen_vertex.glsl").c_str(), (shaderDir + "oit_composite_fragment.glsl").c_str()));
+
+    compositeShader->use();
+    compositeShader->setInt("accumTexture", 0);
+    compositeShader->setInt("weightTexture", 1);
+
+    batch.create(cubeVBO, cubeEBO);
+
+    // Tam ekran üçgeni için boş VAO (core profile çizimde bir VAO bağlı olmasını ister)
+    glGenVertexArrays(1, &emptyVAO);
+    return true;
+}
+
+void TransparencyRenderer::resize(const RenderTarget& scene) {
+    if (scene.width == width && scene.height == height && scene.depthTexture == sharedDepthTexture && oitFBO != 0) {
+        return;
+    }
+    destroyTargets();
+    width = scene.width;
+    height = scene.height;
+    sharedDepthTexture = scene.depthTexture;
+
+    // Ağırlıklı renk toplamı + görünürlük
+    glGenTextures(1, &accumTexture);
+    glBindTexture(GL_TEXTURE_2D, accumTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA16F, width, height, 0, GL_RGBA, GL_HALF_FLOAT, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    // Ağırlık toplamı
+    glGenTextures(1, &weightTexture);
+    glBindTexture(GL_TEXTURE_2D, weightTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R16F, width, height, 0, GL_RED, GL_HALF_FLOAT, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    // Opak geçişin derinliği paylaşılır - saydam yüzeyler opak olanların arkasında kalırsa elenir
+    glGenFramebuffers(1, &oitFBO);
+    glBindFramebuffer(GL_FRAMEBUFFER, oitFBO);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, accumTexture, 0);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, weightTexture, 0);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, sharedDepthTexture, 0);
+    const GLenum drawBuffers[] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1 };
+    glDrawBuffers(2, drawBuffers);
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        std::cerr << "HATA: OIT framebuffer'ı eksik" << std::endl;
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void TransparencyRenderer::setInstances(const std::vector<CubeInstance>& newInstances) {
+    instances = newInstances;
+    batch.upload(instances.data(), instanceCount());
+}
+
+void TransparencyRenderer::prepare(TransparencyMode mode, const float* view) {
+    if (mode == TransparencyMode::SortedCPU && !instances.empty()) {
+        sortBackToFront(view);
+    }
+}
+
+void TransparencyRenderer::render(TransparencyMode mode, const RenderTarget& scene, Shader& sortedShader,
+                                  const float* view, const float* projection, float ambientStrength) {
+    if (mode == TransparencyMode::Off || instances.empty()) {
+        return;
+    }
+
+    if (mode == TransparencyMode::WeightedOIT) {
+        renderWeightedOIT(scene, view, projection, ambientStrength);
+    } else {
+        renderSorted(sortedShader, view, projection);
+    }
+}
+
+void TransparencyRenderer::sortBackToFront(const float* view) {
+    auto start = std::chrono::steady_clock::now();
+    const size_t count = instances.size();
+    sortKeys.resize(count);
+    sortIndices.resize(count);
+    sortedInstances.resize(count);
+    unsigned int threads = Parallel::workerCount();
+
+    // Görüş uzayı derinliği: z_view = satır 2 · (x, y, z, 1); kameranın önü negatif z
+    Parallel::forRange(count, threads, [&](size_t begin, size_t end, unsigned int) {
+        for (size_t i = begin; i < end; i++) {
+            const float* p = instances[i].offset;
+            float depth = -(view[2] * p[0] + view[6] * p[1] + view[10] * p[2] + view[14]);
+
+            // Float'ı sıralanabilir işaretsiz tamsayıya çevir, sonra azalan sıra için ters çevir
+            uint32_t bits;
+            std::memcpy(&bits, &depth, sizeof(bits));
+            bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+            sortKeys[i] = ~bits;
+            sortIndices[i] = static_cast<uint32_t>(i);
+        }
+    });
+
+    parallelRadixSort(sortKeys, sortIndices, threads);
+
+    // Örnekleri sıralı düzende topla
+    Parallel::forRange(count, threads, [&](size_t begin, size_t end, unsigned int) {
+        for (size_t i = begin; i < end; i++) {
+            sortedInstances[i] = instances[sortIndices[i]];
+        }
+    });
+
+    batch.upload(sortedInstances.data(), static_cast<unsigned int>(count));
+
+    auto stop = std::chrono::steady_clock::now();
+    lastSortMs = std::chrono::duration<float, std::milli>(stop - start).count();
+}
+
+void TransparencyRenderer::renderWeightedOIT(const RenderTarget& scene, const float* view, const float* projection, float ambientStrength) {
+    static const float identity[16] = { 1, 0, 0, 0,  0, 1, 0, 0,  0, 0, 1, 0,  0, 0, 0, 1 };
+    static const float clearAccum[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    static const float clearWeight[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+    // 1. Birikim geçişi - derinlik testi açık, derinlik yazımı kapalı
+    glBindFramebuffer(GL_FRAMEBUFFER, oitFBO);
+    glViewport(0, 0, width, height);
+    glClearBufferfv(GL_COLOR, 0, clearAccum);
+    glClearBufferfv(GL_COLOR, 1, clearWeight);
+
+    glEnable(GL_DEPTH_TEST);
+    glDepthMask(GL_FALSE);
+    glEnable(GL_BLEND);
+    glBlendFuncSeparate(GL_ONE, GL_ONE, GL_ZERO, GL_ONE_MINUS_SRC_ALPHA);
+
+    accumShader->use();
+    accumShader->setMat4("model", identity);
+    accumShader->setMat4("view", view);
+    accumShader->setMat4("projection", projection);
+    accumShader->setFloat("ambientStrength", ambientStrength);
+    batch.draw();
+
+    // 2. Birleştirme - ortalama saydam renk opak sahnenin üzerine karıştırılır
+    scene.bind();
+    glDisable(GL_DEPTH_TEST);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    compositeShader->use();
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, accumTexture);
+    glActiveTexture(GL_TEXTURE0 + 1);
+    glBindTexture(GL_TEXTURE_2D, weightTexture);
+    glBindVertexArray(emptyVAO);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    // Durumu geri yükle
+    glActiveTexture(GL_TEXTURE0);
+    glDisable(GL_BLEND);
+    glDepthMask(GL_TRUE);
+    glEnable(GL_DEPTH_TEST);
+}
+
+void TransparencyRenderer::renderSorted(Shader& shader, const float* view, const float* projection) {
+    static const float identity[16] = { 1, 0, 0, 0,  0, 1, 0, 0,  0, 0, 1, 0,  0, 0, 0, 1 };
+
+    // Klasik alfa karıştırma - örnekler arkadan öne sıralı olduğundan doğru sonuç verir
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glDepthMask(GL_FALSE);
+
+    shader.use();
+    shader.setMat4("model", identity);
+    shader.setMat4("view", view);
+    shader.setMat4("projection", projection);
+    batch.draw();
+
+    glDepthMask(GL_TRUE);
+    glDisable(GL_BLEND);
+}
+
+void TransparencyRenderer::destroyTargets() {
+    if (oitFBO != 0) {
+        glDeleteFramebuffers(1, &oitFBO);
+        glDeleteTextures(1, &accumTexture);
+        glDeleteTextures(1, &weightTexture);
+    }
+    oitFBO = accumTexture = weightTexture = 0;
+    width = height = 0;
+}
+
+void TransparencyRenderer::destroy() {
+    destroyTargets();
+    batch.destroy();
+    glDeleteVertexArrays(1, &emptyVAO);
+    emptyVAO = 0;
+    if (accumShader) {
+        accumShader->destroy();
+        accumShader.reset();
+    }
+    if (compositeShader) {
+        compositeShader->destroy();
+        compositeShader.reset();
+    }
+}
+
+void runTransparencyBenchmark(TransparencyRenderer& renderer, RenderTarget& scene, Shader& sortedShader,
+                              const float* view, const float* projection) {
+    const unsigned int counts[] = { 10000, 25000, 50000, 100000 };
+    const TransparencyMode modes[] = { TransparencyMode::WeightedOIT, TransparencyMode::SortedCPU };
+    const int warmupFrames = 3;
+    const int measuredFrames = 20;
+
+    renderer.resize(scene);
+
+    std::cout << "Saydamlık karşılaştırması (" << scene.width << "x" << scene.height
+              << ", kare başına ortalama, " << measuredFrames << " kare)" << std::endl;
+    std::cout << std::setw(10) << "küp" << std::setw(18) << "yöntem"
+              << std::setw(14) << "kare (ms)" << std::setw(14) << "sıralama (ms)" << std::endl;
+
+    for (unsigned int count : counts) {
+        // Hepsi küçük bir hacimde - yoğun örtüşme
+        renderer.setInstances(generateTransparentCubes(count, 1.5f, 1234u + count));
+
+        for (TransparencyMode mode : modes) {
+            double totalMs = 0.0;
+            double sortMs = 0.0;
+            for (int frame = 0; frame < warmupFrames + measuredFrames; frame++) {
+                auto start = std::chrono::steady_clock::now();
+
+                scene.bind();
+                glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+                glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+                renderer.prepare(mode, view);
+                renderer.render(mode, scene, sortedShader, view, projection, 0.3f);
+                glFinish();
+
+                auto stop = std::chrono::steady_clock::now();
+                if (frame >= warmupFrames) {
+                    totalMs += std::chrono::duration<double, std::milli>(stop - start).count();
+                    if (mode == TransparencyMode::SortedCPU) {
+                        sortMs += renderer.lastSortMs;
+                    }
+                }
+            }
+
+            std::cout << std::setw(10) << count << std::setw(18) << transparencyModeName(mode)
+                      << std::setw(14) << std::fixed << std::setprecision(2) << totalMs / measuredFrames
+                      << std::setw(14) << sortMs / measuredFrames << std::endl;
+        }
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
@@ -0,0 +1,81 @@
+#ifndef TRANSPARENCY_H
+#define TRANSPARENCY_H
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "render_target.h"
+#include "scene.h"
+#include "shader.h"
+
+// Saydam küplerin çizim yöntemi
+enum class TransparencyMode {
+    Off,         // Saydam küpler çizilmez
+    WeightedOIT, // Ağırlıklı karıştırmalı OIT - tek geometri geçişi, iki hedef, bir birleştirme (varsayılan)
+    SortedCPU    // Örnekler CPU'da görüş derinliğine göre arkadan öne sıralanır
+};
+
+const char* transparencyModeName(TransparencyMode mode);
+
+// 32 bitlik anahtarları (ve eşlik eden değerleri) artan sırada, kararlı biçimde sıralar
+// 8 bitlik basamaklarla LSD radix sort; histogram ve dağıtım adımları iş parçacıklarına bölünür
+void parallelRadixSort(std::vector<uint32_t>& keys, std::vector<uint32_t>& values, unsigned int threadCount);
+
+// Yarı saydam küp örneklerini opak sahnenin üzerine çizer
+class TransparencyRenderer {
+public:
+    float lastSortMs = 0.0f; // Son sıralamanın CPU süresi (SortedCPU modu)
+
+    bool init(const std::string& shaderDir, unsigned int cubeVBO, unsigned int cubeEBO);
+
+    // OIT hedeflerini sahne hedefinin boyutuna göre (yeniden) oluşturur; derinlik dokusu paylaşılır
+    void resize(const RenderTarget& scene);
+
+    // Çizilecek örnekleri ayarlar
+    void setInstances(const std::vector<CubeInstance>& newInstances);
+    unsigned int instanceCount() const { return static_cast<unsigned int>(instances.size()); }
+
+    // SortedCPU modunda örnekleri arkadan öne sıralar (CPU işi); render()'dan önce çağrılır
+    void prepare(TransparencyMode mode, const float* view);
+
+    // Saydam geçişi çalıştırır; sahne hedefi bağlı ve opak geometri çizilmiş olmalı
+    // sortedShader SortedCPU modunda kullanılır (ana shader, alfa çıkışlı)
+    void render(TransparencyMode mode, const RenderTarget& scene, Shader& sortedShader,
+                const float* view, const float* projection, float ambientStrength);
+
+    void destroy();
+
+private:
+    std::unique_ptr<Shader> accumShader;
+    std::unique_ptr<Shader> compositeShader;
+    InstanceBatch batch;
+    unsigned int emptyVAO = 0;
+
+    // OIT birikim hedefleri
+    unsigned int oitFBO = 0;
+    unsigned int accumTexture = 0;  // RGBA16F
+    unsigned int weightTexture = 0; // R16F
+    int width = 0;
+    int height = 0;
+    unsigned int sharedDepthTexture = 0;
+
+    // CPU sıralaması için tekrar kullanılan tamponlar
+    std::vector<CubeInstance> instances;
+    std::vector<CubeInstance> sortedInstances;
+    std::vector<uint32_t> sortKeys;
+    std::vector<uint32_t> sortIndices;
+
+    void sortBackToFront(const float* view);
+    void renderWeightedOIT(const RenderTarget& scene, const float* view, const float* projection, float ambientStrength);
+    void renderSorted(Shader& shader, const float* view, const float* projection);
+    void destroyTargets();
+};
+
+// 10k-100k örtüşen küpte iki yöntemin kare sürelerini karşılaştırır ve sonuçları yazdırır
+void runTransparencyBenchmark(TransparencyRenderer& renderer, RenderTarget& scene, Shader& sortedShader,
+                              const float* view, const float* projection);
+
+#endif // TRANSPARENCY_H